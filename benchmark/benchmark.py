@@ -4,7 +4,7 @@
 # Created: Mar 2017
 
 from __future__ import print_function
-import sys, os, subprocess, shlex, time
+import sys, os, subprocess, shlex, time, argparse
 
 # Some Python 3 compatibility shims
 if sys.version_info.major < 3:
@@ -15,8 +15,9 @@ else:
 class ErrorHandlingSystem(object):
     "Base class for an error handling system"
 
-    def __init__(self):
-        pass
+    def __init__(self, threaded = False):
+        # Threaded runs keep the counters per thread, else they would measure cache line contention
+        self.thread_local = 'thread_local ' if threaded else ''
 
     def preamble(self, idx):
         "Preamble written out before each source file"
@@ -35,9 +36,9 @@ class ErrorHandlingSystem(object):
         for n in range(0, no):
             with open("source%04d.cpp" % n, 'wt') as oh:
                 oh.write(self.preamble(n))
-                oh.write(r'''extern volatile int counter;
+                oh.write(r'''extern %(tl)svolatile int counter, failing;
 struct RAII { RAII() { ++counter; } ~RAII() { --counter; } };
-''')
+''' % {'tl': self.thread_local})
                 if n:
                     oh.write(self.function_cont("funct%04d" % (n-1)) + ';\n')
                 oh.write(self.function_cont("funct%04d" % n))
@@ -98,6 +99,50 @@ class ResultExperimentalError(ResultExperimentalValue):
     def function_final(self):
         return r'''{ return OUTCOME_V2_NAMESPACE::experimental::errc::io_error; }'''
 
+# The systems of the failure rate sweep, whose final function fails whenever the runner sets failing
+class SweepIntegerReturns(ErrorHandlingSystem):
+    def function_final(self):
+        return r'''{ return failing ? -1 : 0; }'''
+
+class SweepExceptionThrow(ExceptionThrow):
+    def function_final(self):
+        return r'''{ if(failing) throw std::exception(); return par; }'''
+
+class SweepResultError(ResultErrorValue):
+    def function_final(self):
+        return r'''{ if(failing) return std::error_code(5, std::generic_category()); return par; }'''
+
+class SweepResultException(ResultExceptionValue):
+    def function_final(self):
+        return r'''{ if(failing) return std::make_exception_ptr(std::exception()); return par; }'''
+
+class SweepResultExperimental(ResultExperimentalValue):
+    def function_final(self):
+        return r'''{ if(failing) return OUTCOME_V2_NAMESPACE::experimental::errc::io_error; return par; }'''
+
+class SweepOutcomeSharedException(ErrorHandlingSystem):
+    "Every failure copies the same exception_ptr, so all threads contend on its reference count"
+    def preamble(self, idx):
+        ret = '#include "../include/outcome/outcome.hpp"\n'
+        if idx == 0:
+            ret += 'const std::exception_ptr &shared_exception() { static const std::exception_ptr v = std::make_exception_ptr(std::exception()); return v; }\n'
+        else:
+            ret += 'extern const std::exception_ptr &shared_exception();\n'
+        return ret
+    def function_cont(self, name):
+        return 'extern OUTCOME_V2_NAMESPACE::outcome<int> %s(int par)' % name
+    def function_final(self):
+        return r'''{ if(failing) return shared_exception(); return par; }'''
+
+sweep_matrix = [
+    ('integer-returns', SweepIntegerReturns),
+    ('exception-throw', SweepExceptionThrow),
+    ('result-error', SweepResultError),
+    ('result-excpt', SweepResultException),
+    ('result-exper', SweepResultExperimental),
+    ('outcome-shared-excpt', SweepOutcomeSharedException),
+]
+
 matrix = [
     ('integer-returns', ErrorHandlingSystem),
     ('exception-throw', ExceptionThrow),
@@ -128,59 +173,106 @@ else:
         ('clang90-lto', r'clang++-9 -std=c++17 -O3 -g -flto -o %s -I../.. -I../../quickcpplib/include'),
     ]
 
-SOURCES=10
-if len(sys.argv)>1:
-    SOURCES = int(sys.argv[1])
+parser = argparse.ArgumentParser(description='Benchmark Outcome against other stuff')
+parser.add_argument('sources', nargs='?', type=int, default=10, help='Depth of the generated call chain')
+parser.add_argument('--sweep', help='Comma separated failure percentages, e.g. 0,1,10,50, to sweep instead of running the usual matrix')
+parser.add_argument('--threads', help='Comma separated thread counts, e.g. 1,2,4,8, for each failure percentage of the sweep')
+args = parser.parse_args()
+SOURCES = args.sources
+
+def build(instance, compiler, exename, extra_args = []):
+    "Generates the sources for instance and compiles them into exename"
+    try:
+        print("\nGenerating sources for", exename, "...")
+        instance.generate_sources(SOURCES)
+        cmd = shlex.split(compiler[1] % exename) + extra_args
+        cmd.append("runner.cpp")
+        for n in range(0, SOURCES):
+            cmd.append("source%04d.cpp" % n)
+        if sys.platform == 'win32':
+            cmd.append("/link")
+            cmd.append("/OPT:REF,ICF")
+        try:
+            print("Compiling", exename, "...")
+            compile_begin = clock()
+            print(subprocess.check_output(cmd))
+            compile_end = clock()
+            print("Compile took", compile_end-compile_begin, "secs.")
+        except subprocess.CalledProcessError as e:
+            print(e.output)
+            raise
+    finally:
+        for n in range(0, SOURCES):
+            if os.path.exists("source%04d.cpp" % n):
+                os.remove("source%04d.cpp" % n)
+            if os.path.exists("source%04d.obj" % n):
+                os.remove("source%04d.obj" % n)
+        os.remove("function.h")
+        if os.path.exists("runner.obj"):
+            os.remove("runner.obj")
+    if sys.platform != 'win32':
+        exename = './' + exename
+    return exename
+
+if args.sweep or args.threads:
+    # Each system is compiled once, then run for every failure rate and thread count
+    rates = [float(x) for x in (args.sweep or '0,1,10,50').split(',')]
+    threads = [int(x) for x in (args.threads or '1').split(',')]
+    threaded = max(threads) > 1
+    if threaded:
+        extra_args = ['/DBENCHMARK_THREADED=1'] if sys.platform == 'win32' else ['-DBENCHMARK_THREADED=1', '-pthread']
+    else:
+        extra_args = []
+    with open('results-'+sys.platform+'-sweep.csv', 'wt') as resultsh:
+        resultsh.write('"Compiler"')
+        for m in sweep_matrix:
+            for rate in rates:
+                for t in threads:
+                    resultsh.write(',"%s-%gpc-%dt"' % (m[0], rate, t))
+        resultsh.write('\n')
+        for compiler in compilers:
+            resultsh.write('"'+compiler[0]+'"')
+            for m in sweep_matrix:
+                if 'noexcept' in compiler[0] and m[0] == 'exception-throw':
+                    resultsh.write(',' * (len(rates) * len(threads)))
+                    continue
+                exename = build(m[1](threaded), compiler, 'sweep-' + m[0] + '_' + compiler[0], extra_args)
+                for rate in rates:
+                    for t in threads:
+                        print("Running", exename, "at", rate, "% failure on", t, "threads ...")
+                        result = subprocess.check_output([exename, str(int(rate * 10)), str(t)]).decode('utf-8').splitlines()
+                        resultsh.write(',' + result[0].rstrip())
+                        resultsh.flush()
+            resultsh.write('\n')
+    sys.exit(0)
+
+# The runner prints ticks per iteration, then if hardware performance counters were
+# available, a line of counts per iteration of each of these
+counters = ['instructions', 'cycles', 'branch-misses', 'l1d-misses']
 
-with open('results-'+sys.platform+'.csv', 'wt') as resultsh:
+with open('results-'+sys.platform+'.csv', 'wt') as resultsh, open('results-'+sys.platform+'-counters.csv', 'wt') as countersh:
     resultsh.write('"Compiler"')
+    countersh.write('"Compiler"')
     for m in matrix:
         resultsh.write(',"'+m[0]+'"')
+        for c in counters:
+            countersh.write(',"'+m[0]+'-'+c+'"')
     resultsh.write('\n')
+    countersh.write('\n')
     for compiler in compilers:
         resultsh.write('"'+compiler[0]+'"')
+        countersh.write('"'+compiler[0]+'"')
         for m in matrix:
             if 'noexcept' in compiler[0] and m[0] == 'exception-throw':
                 resultsh.write(',')
+                countersh.write(',' * len(counters))
                 continue
-            instance = m[1]()
-            try:
-                exename = m[0]+'_'+compiler[0]
-                print("\nGenerating sources for", exename, "...")
-                instance.generate_sources(SOURCES)
-                args = shlex.split(compiler[1] % exename)
-                args.append("runner.cpp")
-                for n in range(0, SOURCES):
-                    args.append("source%04d.cpp" % n)
-                if sys.platform == 'win32':
-                    args.append("/link")
-                    args.append("/OPT:REF,ICF")
-                #print(' '.join(args))
-                try:
-                    print("Compiling", exename, "...")
-                    compile_begin = clock()
-                    print(subprocess.check_output(args))
-                    compile_end = clock()
-                    print("Compile took", compile_end-compile_begin, "secs. Running executable ...")
-                except subprocess.CalledProcessError as e:
-                    print(e.output)
-                    raise
-            finally:
-                for n in range(0, SOURCES):
-                    if os.path.exists("source%04d.cpp" % n):
-                        os.remove("source%04d.cpp" % n)
-                    if os.path.exists("source%04d.obj" % n):
-                        os.remove("source%04d.obj" % n)
-                os.remove("function.h")
-                #if os.path.exists(exename):
-                #    os.remove(exename)
-                #if os.path.exists(exename+'.exe'):
-                #    os.remove(exename+'.exe')
-                if os.path.exists("runner.obj"):
-                    os.remove("runner.obj")
-            if sys.platform != 'win32':
-                exename = './' + exename
-            result = subprocess.check_output([exename]).decode('utf-8')
-            resultsh.write(',' + result.rstrip())
+            exename = build(m[1](), compiler, m[0]+'_'+compiler[0])
+            print("Running executable ...")
+            result = subprocess.check_output([exename]).decode('utf-8').splitlines()
+            resultsh.write(',' + result[0].rstrip())
             resultsh.flush()
+            countersh.write(',' + (result[1].rstrip() if len(result) > 1 else ',' * (len(counters) - 1)))
+            countersh.flush()
         resultsh.write('\n')
+        countersh.write('\n')
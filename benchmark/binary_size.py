@@ -0,0 +1,144 @@
+#!/usr/bin/python
+# Binary size regression benchmark for result and outcome instantiations
+# (C) 2024 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2024
+#
+# Compiles a fixed corpus of translation units, each instantiating the wide
+# observers of many result and outcome types, and reports the size of .text.
+# Pass --baseline results-binary-size-linux.csv to fail if any compiler's
+# .text grew by more than --tolerance percent. The outcome-binary-size CMake
+# target does this against the baseline committed beside this script.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, argparse, csv, re
+
+SOURCES = 8          # translation units in the corpus
+TYPES_PER_SOURCE = 16  # distinct value types per translation unit
+
+srcdir = os.path.dirname(os.path.abspath(__file__))
+
+corpus_preamble = r'''#include "outcome.hpp"
+namespace outcome = OUTCOME_V2_NAMESPACE;
+'''
+
+def generate_sources(sources, types):
+    "Generate a corpus where every translation unit instantiates its own value types against the same error types"
+    for n in range(0, sources):
+        with open("corpus%04d.cpp" % n, 'wt') as oh:
+            oh.write(corpus_preamble)
+            for t in range(0, types):
+                name = "value%04d_%04d" % (n, t)
+                oh.write(r'''
+struct %(name)s { int v[%(size)d]; };
+int %(name)s_result(const outcome::result<%(name)s> &r) { return r.value().v[0] + r.error().value(); }
+int %(name)s_result_ep(const outcome::result<%(name)s, std::exception_ptr> &r) { return r.value().v[0]; }
+int %(name)s_result_bra(const outcome::result<%(name)s, int, outcome::policy::throw_bad_result_access<int, void>> &r) { return r.value().v[0] + r.error(); }
+int %(name)s_outcome(const outcome::outcome<%(name)s> &r) { return r.value().v[0] + r.error().value(); }
+''' % {'name': name, 'size': 1 + (t % 4)})
+    with open("corpus_main.cpp", 'wt') as oh:
+        oh.write('int main(void) { return 0; }\n')
+
+if sys.platform == 'win32':
+    compilers = [
+        ('msvc', r'cl /nologo /std:c++17 /O2 /Gy /MD /EHsc /Fe%s'),
+    ]
+elif sys.platform == 'darwin':
+    compilers = [
+        ('clang', r'clang++ -std=c++17 -O2 -o %s'),
+    ]
+else:
+    compilers = [
+        ('gcc', r'g++ -std=c++17 -O2 -o %s'),
+        ('gcc-noexcept', r'g++ -std=c++17 -O2 -fno-exceptions -o %s'),
+        ('clang', r'clang++ -std=c++17 -O2 -o %s'),
+    ]
+
+def compiler_version(cmd):
+    "Returns the major version of a GCC or clang, so baselines are only compared against the same compiler"
+    try:
+        return subprocess.check_output([cmd, '-dumpversion'], stderr=subprocess.STDOUT).decode('utf-8').strip().split('.')[0]
+    except (subprocess.CalledProcessError, OSError):
+        return ''
+
+def text_size(exename):
+    "Returns the size in bytes of the executable code and read only data"
+    if sys.platform == 'win32':
+        out = subprocess.check_output(['dumpbin', '/headers', exename]).decode('utf-8')
+        m = re.search(r'\.text name\s+([0-9A-F]+) virtual size', out)
+        return int(m.group(1), 16) if m else 0
+    # Berkeley format: text data bss dec hex filename
+    out = subprocess.check_output(['size', exename]).decode('utf-8')
+    return int(out.splitlines()[1].split()[0])
+
+parser = argparse.ArgumentParser(description='Binary size regression benchmark for Outcome')
+parser.add_argument('--baseline', help='CSV of previous results to compare against')
+parser.add_argument('--tolerance', type=float, default=2.0, help='Percentage growth in .text permitted against the baseline')
+parser.add_argument('--compiler', action='append', help='Only run the named compiler(s)')
+parser.add_argument('--include-dir', action='append', help='Additional include directory, e.g. for quickcpplib')
+parser.add_argument('--output-dir', default='.', help='Where to write the corpus, binaries and results')
+args = parser.parse_args()
+
+# Read the baseline before anything is written, in case it is also the output
+baseline = {}
+if args.baseline:
+    with open(args.baseline, 'rt') as ih:
+        for row in csv.DictReader(ih):
+            baseline[row['Compiler']] = int(row['text-bytes'])
+
+include_dirs = [os.path.join(srcdir, '..', 'include'), os.path.join(srcdir, '..', '..', 'quickcpplib', 'include')]
+include_dirs += [os.path.abspath(d) for d in (args.include_dir or [])]
+if not os.path.isdir(args.output_dir):
+    os.makedirs(args.output_dir)
+os.chdir(args.output_dir)
+
+results = []
+generate_sources(SOURCES, TYPES_PER_SOURCE)
+try:
+    for compiler in compilers:
+        if args.compiler and compiler[0] not in args.compiler:
+            continue
+        exename = 'binary_size_' + compiler[0]
+        cmd = shlex.split(compiler[1] % exename)
+        cmd += [('/I' if compiler[0] == 'msvc' else '-I') + d for d in include_dirs]
+        cmd.append('corpus_main.cpp')
+        for n in range(0, SOURCES):
+            cmd.append("corpus%04d.cpp" % n)
+        print("Compiling", exename, "...")
+        try:
+            subprocess.check_output(cmd, stderr=subprocess.STDOUT)
+        except (subprocess.CalledProcessError, OSError) as e:
+            print("Skipping", compiler[0], "as it failed to compile:", getattr(e, 'output', e))
+            continue
+        if sys.platform != 'win32':
+            exename = './' + exename
+        size = text_size(exename)
+        family, _, variant = compiler[0].partition('-')
+        name = family + compiler_version(cmd[0]) + ('-' + variant if variant else '')
+        print(name, ".text is", size, "bytes")
+        results.append((name, size))
+finally:
+    for n in range(0, SOURCES):
+        for ext in ('.cpp', '.obj', '.o'):
+            if os.path.exists("corpus%04d%s" % (n, ext)):
+                os.remove("corpus%04d%s" % (n, ext))
+    if os.path.exists("corpus_main.cpp"):
+        os.remove("corpus_main.cpp")
+
+with open('results-binary-size-' + sys.platform + '.csv', 'wt') as resultsh:
+    resultsh.write('"Compiler","text-bytes"\n')
+    for r in results:
+        resultsh.write('"%s",%d\n' % r)
+
+if args.baseline:
+    regressed = False
+    for name, size in results:
+        if name in baseline:
+            growth = 100.0 * (size - baseline[name]) / baseline[name]
+            print("%s: %d -> %d bytes (%+.2f%%)" % (name, baseline[name], size, growth))
+            if growth > args.tolerance:
+                regressed = True
+        else:
+            print("%s: no baseline, %d bytes reported only" % (name, size))
+    if regressed:
+        print("FAILED: .text grew by more than", args.tolerance, "percent")
+        sys.exit(1)
@@ -0,0 +1,63 @@
+/* Benchmark of boxed_error on success dominated workloads
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Prints the size of each result, and the ticks per element to produce then consume an array
+of results of which one in FAILURE_PERIOD is a failure:
+
+g++ -std=c++17 -O3 -o boxed_error boxed_error.cpp
+*/
+
+#include "harness.h"
+#include "../include/outcome/boxed_error.hpp"
+
+// A rich error, of the kind which carries context about where and why
+struct rich_error
+{
+  int code;
+  char context[60];
+};
+
+template <class R> double run(std::vector<R> &results)
+{
+  return ticks_per_element([&] {
+    results.clear();
+    fill(results, [](int n) { return rich_error{n, "context"}; });
+    consume(results);
+  });
+}
+
+int main(void)
+{
+  warm_up();
+  using inline_result = OUTCOME_V2_NAMESPACE::result<int, rich_error, OUTCOME_V2_NAMESPACE::policy::all_narrow>;
+  using boxed_result = OUTCOME_V2_NAMESPACE::result<int, OUTCOME_V2_NAMESPACE::boxed_error<rich_error>, OUTCOME_V2_NAMESPACE::policy::all_narrow>;
+  std::vector<inline_result> a;
+  std::vector<boxed_result> b;
+  a.reserve(ELEMENTS);
+  b.reserve(ELEMENTS);
+  printf("Result,Bytes,Ticks per element\n");
+  printf("result<int, rich_error>,%u,%f\n", (unsigned) sizeof(inline_result), run(a));
+  printf("result<int, boxed_error<rich_error>>,%u,%f\n", (unsigned) sizeof(boxed_result), run(b));
+  return 0;
+}
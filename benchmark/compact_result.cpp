@@ -0,0 +1,61 @@
+/* Benchmark of the density of large arrays of results with a compact status
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Prints the size of each result, and the ticks per element to copy and then scan a vector
+of results too large for the caches, of which one in FAILURE_PERIOD is an error:
+
+g++ -std=c++17 -O3 -o compact_result compact_result.cpp
+*/
+
+#define ELEMENTS (1 << 24)
+#define ITERATIONS 8
+
+#include "harness.h"
+#include "../include/outcome/compact_result.hpp"
+
+#include <cstdint>
+
+template <class R> void print(const char *name)
+{
+  using error_type = typename R::error_type;
+  auto source = make<R>([](int n) { return R(OUTCOME_V2_NAMESPACE::in_place_type<error_type>, static_cast<error_type>(n)); });
+  printf("%s,%u,%f\n", name, (unsigned) sizeof(R), ticks_per_element([&] {
+           std::vector<R> copy(source);
+           consume(copy);
+         }));
+}
+
+int main(void)
+{
+  warm_up();
+  using namespace OUTCOME_V2_NAMESPACE;
+  printf("Result,Bytes,Ticks per element\n");
+  print<result<uint16_t, uint8_t>>("result<uint16_t, uint8_t>");
+  print<compact_result<uint16_t, uint8_t>>("compact_result<uint16_t, uint8_t>");
+  print<result<bool, uint8_t>>("result<bool, uint8_t>");
+  print<compact_result<bool, uint8_t>>("compact_result<bool, uint8_t>");
+  print<result<uint32_t, uint16_t>>("result<uint32_t, uint16_t>");
+  print<compact_result<uint32_t, uint16_t>>("compact_result<uint32_t, uint16_t>");
+  return 0;
+}
@@ -0,0 +1,155 @@
+#!/usr/bin/python
+# Compile time benchmark for result and outcome instantiations
+# (C) 2024 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2024
+#
+# Compiles a translation unit which only includes Outcome, and one which also
+# instantiates many distinct result and outcome types, and reports the time
+# taken by each and the time the compiler reports spending on template
+# instantiation (-ftime-report for GCC, -ftime-trace for clang). Pass
+# --baseline results-compile-time-linux.csv to fail if any compiler's time
+# to instantiate grew by more than --tolerance percent.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, argparse, csv, re, json, time
+
+# Some Python 3 compatibility shims
+if sys.version_info.major < 3:
+    clock = time.clock
+else:
+    clock = time.perf_counter
+
+corpus_preamble = r'''#include "../include/outcome.hpp"
+namespace outcome = OUTCOME_V2_NAMESPACE;
+'''
+
+def generate_sources(instantiations):
+    "Generate an include only translation unit, and one instantiating many distinct types"
+    with open("compile_time_include.cpp", 'wt') as oh:
+        oh.write(corpus_preamble)
+    with open("compile_time_instantiate.cpp", 'wt') as oh:
+        oh.write(corpus_preamble)
+        for t in range(0, instantiations):
+            oh.write(r'''
+struct value%(t)04d { int v[%(size)d]; };
+int test%(t)04d(int x)
+{
+  outcome::result<value%(t)04d> r(value%(t)04d{});
+  if(x) r = std::errc::io_error;
+  outcome::result<value%(t)04d, int> i(outcome::in_place_type<int>, x);
+  outcome::outcome<value%(t)04d> o(std::move(r));
+  return o.has_value() ? o.value().v[0] : (o.error().value() + i.assume_error());
+}
+''' % {'t': t, 'size': 1 + (t % 4)})
+
+if sys.platform == 'win32':
+    compilers = [
+        ('msvc', r'cl /nologo /std:c++17 /c /EHsc /I..\\.. /I..\\..\\quickcpplib\\include /Fo%s'),
+        ('msvc-cxx20', r'cl /nologo /std:c++20 /c /EHsc /I..\\.. /I..\\..\\quickcpplib\\include /Fo%s'),
+    ]
+elif sys.platform == 'darwin':
+    compilers = [
+        ('clang', r'clang++ -std=c++17 -c -o %s -I../.. -I../../quickcpplib/include'),
+        ('clang-cxx20', r'clang++ -std=c++20 -c -o %s -I../.. -I../../quickcpplib/include'),
+    ]
+else:
+    compilers = [
+        ('gcc', r'g++ -std=c++17 -c -o %s -I../.. -I../../quickcpplib/include'),
+        ('gcc-cxx20', r'g++ -std=c++20 -c -o %s -I../.. -I../../quickcpplib/include'),
+        ('clang', r'clang++ -std=c++17 -c -o %s -I../.. -I../../quickcpplib/include'),
+        ('clang-cxx20', r'clang++ -std=c++20 -c -o %s -I../.. -I../../quickcpplib/include'),
+    ]
+
+def instantiation_seconds(cmd, objname, output):
+    "Returns the seconds the compiler reports spending on template instantiation, or None"
+    if '-ftime-report' in cmd:
+        # GCC: " template instantiation   :   2.33 ( 41%)   0.87 ( 45%)   3.15 ( 40%)   227M ( 57%)"
+        m = re.search(r'^\s*template instantiation\s*:\s*([0-9.]+)\s*\(\s*[0-9]+%\)\s*([0-9.]+)\s*\(\s*[0-9]+%\)', output, re.MULTILINE)
+        return float(m.group(1)) + float(m.group(2)) if m else None
+    if '-ftime-trace' in cmd:
+        # clang writes the trace next to the object file
+        tracename = os.path.splitext(objname)[0] + '.json'
+        if not os.path.exists(tracename):
+            return None
+        with open(tracename, 'rt') as ih:
+            trace = json.load(ih)
+        os.remove(tracename)
+        total = 0
+        for event in trace.get('traceEvents', []):
+            if event.get('name') in ('Total InstantiateClass', 'Total InstantiateFunction'):
+                total += event.get('dur', 0)
+        return total / 1000000.0
+    return None
+
+def compile_one(compiler, source, repeats):
+    "Returns the least wall clock seconds and the instantiation seconds of compiling source"
+    objname = os.path.splitext(source)[0] + ('.obj' if sys.platform == 'win32' else '.o')
+    cmd = shlex.split(compiler[1] % objname)
+    if 'gcc' in compiler[0]:
+        cmd.append('-ftime-report')
+    elif 'clang' in compiler[0]:
+        cmd.append('-ftime-trace')
+    cmd.append(source)
+    best, instantiation = None, None
+    for n in range(0, repeats):
+        begin = clock()
+        output = subprocess.check_output(cmd, stderr=subprocess.STDOUT).decode('utf-8')
+        end = clock()
+        if best is None or end - begin < best:
+            best = end - begin
+            instantiation = instantiation_seconds(cmd, objname, output)
+    if os.path.exists(objname):
+        os.remove(objname)
+    return best, instantiation
+
+parser = argparse.ArgumentParser(description='Compile time benchmark for Outcome')
+parser.add_argument('--instantiations', type=int, default=64, help='Distinct value types to instantiate result and outcome with')
+parser.add_argument('--repeats', type=int, default=3, help='Compiles of each translation unit, of which the quickest is taken')
+parser.add_argument('--baseline', help='CSV of previous results to compare against')
+parser.add_argument('--tolerance', type=float, default=5.0, help='Percentage growth in instantiation time permitted against the baseline')
+parser.add_argument('--compiler', action='append', help='Only run the named compiler(s)')
+args = parser.parse_args()
+
+results = []
+generate_sources(args.instantiations)
+try:
+    for compiler in compilers:
+        if args.compiler and compiler[0] not in args.compiler:
+            continue
+        print("Compiling with", compiler[0], "...")
+        try:
+            include, _ = compile_one(compiler, "compile_time_include.cpp", args.repeats)
+            total, instantiation = compile_one(compiler, "compile_time_instantiate.cpp", args.repeats)
+        except (subprocess.CalledProcessError, OSError) as e:
+            print("Skipping", compiler[0], "as it failed to compile:", str(getattr(e, "output", e))[:1000])
+            continue
+        # Where the compiler cannot say, the time beyond that of only including Outcome is the best estimate
+        if instantiation is None:
+            instantiation = total - include
+        print("%s: include %.3f secs, with %d instantiations %.3f secs, of which instantiation %.3f secs" % (compiler[0], include, args.instantiations, total, instantiation))
+        results.append((compiler[0], include, total, instantiation))
+finally:
+    for name in ("compile_time_include.cpp", "compile_time_instantiate.cpp"):
+        if os.path.exists(name):
+            os.remove(name)
+
+with open('results-compile-time-' + sys.platform + '.csv', 'wt') as resultsh:
+    resultsh.write('"Compiler","include-seconds","total-seconds","instantiation-seconds"\n')
+    for r in results:
+        resultsh.write('"%s",%f,%f,%f\n' % r)
+
+if args.baseline:
+    baseline = {}
+    with open(args.baseline, 'rt') as ih:
+        for row in csv.DictReader(ih):
+            baseline[row['Compiler']] = float(row['instantiation-seconds'])
+    regressed = False
+    for name, include, total, instantiation in results:
+        if name in baseline:
+            growth = 100.0 * (instantiation - baseline[name]) / baseline[name]
+            print("%s: %.3f -> %.3f secs (%+.2f%%)" % (name, baseline[name], instantiation, growth))
+            if growth > args.tolerance:
+                regressed = True
+    if regressed:
+        print("FAILED: instantiation time grew by more than", args.tolerance, "percent")
+        sys.exit(1)
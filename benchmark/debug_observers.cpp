@@ -0,0 +1,61 @@
+/* Benchmark of observing results in unoptimised builds
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Build as debug builds are, with and without OUTCOME_FORCE_INLINE_OBSERVERS, and compare
+the ticks per observation printed:
+
+g++ -std=c++17 -O0 -o O0 debug_observers.cpp
+g++ -std=c++17 -O0 -DOUTCOME_FORCE_INLINE_OBSERVERS=1 -o O0_inlined debug_observers.cpp
+g++ -std=c++17 -Og -o Og debug_observers.cpp
+g++ -std=c++17 -Og -DOUTCOME_FORCE_INLINE_OBSERVERS=1 -o Og_inlined debug_observers.cpp
+*/
+
+#define ITERATIONS 10000000
+
+#include "harness.h"
+
+int main(void)
+{
+  warm_up();
+  const char *mode = OUTCOME_FORCE_INLINE_OBSERVERS ? "inlined" : "default";
+  OUTCOME_V2_NAMESPACE::result<int> r(5), e(std::errc::invalid_argument);
+  OUTCOME_V2_NAMESPACE::outcome<int> o(5);
+  auto observe_value = [](const auto &v) {
+    if(v.has_value())
+    {
+      sink = sink + v.value() + v.assume_value();
+    }
+  };
+  auto observe_error = [](const auto &v) {
+    if(!v && v.has_error())
+    {
+      sink = sink + v.error().value() + v.assume_error().value();
+    }
+  };
+  printf("Observed,%s\n", mode);
+  printf("result value,%f\n", ticks_per_observation(r, 3, observe_value));
+  printf("result error,%f\n", ticks_per_observation(e, 4, observe_error));
+  printf("outcome value,%f\n", ticks_per_observation(o, 3, observe_value));
+  return 0;
+}
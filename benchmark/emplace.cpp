@@ -0,0 +1,132 @@
+/* Benchmark of reusing one result per iteration of a parsing loop
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Prints the allocations and ticks per iteration of a loop which parses rows into one
+`result<std::vector<Row>>`, by assigning a new result each time, and by reusing the value
+with `reset_to_value()` and `emplace_value()`:
+
+g++ -std=c++17 -O3 -o emplace emplace.cpp
+*/
+
+#define ROWS 256
+#define ITERATIONS 100000
+#define FAILURE_PERIOD 64
+
+#include "harness.h"
+#include <stdlib.h>
+
+#include <new>
+
+static size_t allocations;
+
+void *operator new(size_t bytes)
+{
+  ++allocations;
+  void *ret = malloc(bytes);
+  if(ret == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ret;
+}
+void operator delete(void *p) noexcept
+{
+  free(p);
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  free(p);
+}
+
+struct Row
+{
+  int id;
+  double value;
+};
+using rows_result = OUTCOME_V2_NAMESPACE::result<std::vector<Row>>;
+
+QUICKCPPLIB_NOINLINE rows_result parse(int i)
+{
+  if(is_failure(i))
+  {
+    return std::make_error_code(std::errc::illegal_byte_sequence);
+  }
+  std::vector<Row> rows;
+  for(int n = 0; n < ROWS; n++)
+  {
+    rows.push_back(Row{n, n * 0.5});
+  }
+  return rows;
+}
+
+QUICKCPPLIB_NOINLINE void parse_into(rows_result &r, int i)
+{
+  if(is_failure(i))
+  {
+    r.emplace_error(std::make_error_code(std::errc::illegal_byte_sequence));
+    return;
+  }
+  std::vector<Row> &rows = r.reset_to_value();
+  rows.clear();
+  for(int n = 0; n < ROWS; n++)
+  {
+    rows.push_back(Row{n, n * 0.5});
+  }
+}
+
+static std::vector<Row> source(ROWS, Row{1, 0.5});
+QUICKCPPLIB_NOINLINE void copy_into(rows_result &r, int i)
+{
+  if(is_failure(i))
+  {
+    r.emplace_error(std::make_error_code(std::errc::illegal_byte_sequence));
+    return;
+  }
+  r.emplace_value(source);
+}
+
+template <class F> void run(const char *name, F &&f)
+{
+  rows_result r(std::make_error_code(std::errc::illegal_byte_sequence));
+  const size_t allocations_before = allocations;
+  auto start = ticksclock();
+  for(int i = 0; i < ITERATIONS; i++)
+  {
+    f(r, i);
+    sink = sink + (r.has_value() ? (int) r.assume_value().size() : 0);
+  }
+  auto end = ticksclock();
+  printf("%s,%f,%f\n", name, (double) (allocations - allocations_before) / ITERATIONS, (double) (end - start) / ITERATIONS);
+}
+
+int main(void)
+{
+  warm_up();
+  printf("Strategy,Allocations per iteration,Ticks per iteration\n");
+  run("r = parse()", [](rows_result &r, int i) { r = parse(i); });
+  run("parse_into() with reset_to_value()", [](rows_result &r, int i) { parse_into(r, i); });
+  run("r = rows_result(source)", [](rows_result &r, int i) { r = is_failure(i) ? rows_result(std::make_error_code(std::errc::illegal_byte_sequence)) : rows_result(source); });
+  run("emplace_value(source)", [](rows_result &r, int i) { copy_into(r, i); });
+  return 0;
+}
@@ -0,0 +1,52 @@
+/* Benchmark of exclusive_outcome against outcome
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Prints the size of each outcome, and the ticks per element to copy a vector of outcomes
+of which one in FAILURE_PERIOD is an error:
+
+g++ -std=c++17 -O3 -o exclusive_outcome exclusive_outcome.cpp
+*/
+
+#include "harness.h"
+#include "../include/outcome/exclusive_outcome.hpp"
+
+template <class O> double run()
+{
+  auto source = make<O>([](int /*unused*/) { return std::make_error_code(std::errc::io_error); });
+  return ticks_per_element([&] {
+    std::vector<O> copy(source);
+    consume(copy);
+  });
+}
+
+int main(void)
+{
+  warm_up();
+  using std_outcome = OUTCOME_V2_NAMESPACE::outcome<int>;
+  using exclusive_outcome = OUTCOME_V2_NAMESPACE::exclusive_outcome<int>;
+  printf("Outcome,Bytes,Ticks per element\n");
+  printf("outcome<int>,%u,%f\n", (unsigned) sizeof(std_outcome), run<std_outcome>());
+  printf("exclusive_outcome<int>,%u,%f\n", (unsigned) sizeof(exclusive_outcome), run<exclusive_outcome>());
+  return 0;
+}
@@ -0,0 +1,196 @@
+#!/usr/bin/python
+# Build time and binary size with and without the extern template companion library
+# (C) 2024 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2024
+#
+# Generates a corpus of translation units which each use the result and outcome
+# types instantiated by src/extern_templates.cpp, and builds it from clean twice:
+# once header only, and once with OUTCOME_USE_EXTERN_TEMPLATES=1 and linking in
+# the explicit instantiations, unoptimised and optimised. Reports the time taken to
+# compile the corpus, the total size of its object files, and the size of the
+# linked executable. Unused sections are discarded when linking, as otherwise
+# every instantiation in the library would be linked in.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, argparse, shutil, time
+
+# Some Python 3 compatibility shims
+if sys.version_info.major < 3:
+    clock = time.clock
+else:
+    clock = time.perf_counter
+
+try:
+    from concurrent.futures import ThreadPoolExecutor
+except ImportError:
+    ThreadPoolExecutor = None
+
+corpus_unit = r'''#include "outcome.hpp"
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+namespace unit%(n)04d
+{
+  outcome::result<int> parse(const char *s)
+  {
+    if(s == nullptr || *s == 0)
+    {
+      return std::errc::invalid_argument;
+    }
+    return *s - '0' + %(n)d;
+  }
+  outcome::result<std::string> name(const char *s)
+  {
+    OUTCOME_TRY(auto &&v, parse(s));
+    return std::string(s) + std::to_string(v);
+  }
+  outcome::result<void> check(const char *s)
+  {
+    OUTCOME_TRY(name(s));
+    return outcome::success();
+  }
+  outcome::outcome<int> length(const char *s)
+  {
+    OUTCOME_TRY(check(s));
+    OUTCOME_TRY(auto &&n, name(s));
+    return static_cast<int>(n.size());
+  }
+}
+
+int test%(n)04d(const char *s)
+{
+  auto r = unit%(n)04d::length(s);
+  auto e = unit%(n)04d::name(s);
+  return (r ? r.value() : r.error().value()) + (e.has_error() ? 1 : static_cast<int>(e.assume_value().size()));
+}
+'''
+
+corpus_main = r'''%(decls)s
+int main(int argc, char *argv[])
+{
+  const char *s = (argc > 1) ? argv[1] : "5";
+  int ret = 0;
+%(calls)s  return ret & 1;
+}
+'''
+
+if sys.platform == 'win32':
+    compilers = [
+        ('msvc', {
+            'compile': r'cl /nologo /std:c++17 /EHsc %(opt)s /c /I..\\..\\include /I..\\..\\..\\quickcpplib\\include %(defs)s /Fo%(obj)s %(src)s',
+            'define': r'/D%s',
+            'link': r'cl /nologo /Fe%(exe)s %(objs)s /link /OPT:REF',
+            'obj': '.obj',
+            'opts': ['/Od', '/O2'],
+            'exe': 'corpus.exe',
+        }),
+    ]
+else:
+    compilers = [
+        ('gcc', {
+            'compile': r'g++ -std=c++17 %(opt)s -c -I../../include -I../../../quickcpplib/include %(defs)s -o %(obj)s %(src)s',
+            'define': r'-D%s',
+            'link': r'g++ -Wl,--gc-sections -o %(exe)s %(objs)s',
+            'obj': '.o',
+            'opts': ['-O0', '-O2'],
+            'exe': 'corpus',
+        }),
+        ('clang', {
+            'compile': r'clang++ -std=c++17 %(opt)s -c -I../../include -I../../../quickcpplib/include %(defs)s -o %(obj)s %(src)s',
+            'define': r'-D%s',
+            'link': r'clang++ -Wl,--gc-sections -o %(exe)s %(objs)s',
+            'obj': '.o',
+            'opts': ['-O0', '-O2'],
+            'exe': 'corpus',
+        }),
+    ]
+
+builddir = 'extern_templates'
+
+def generate_sources(units):
+    "Generate the corpus of translation units, returning their paths"
+    if os.path.exists(builddir):
+        shutil.rmtree(builddir)
+    os.mkdir(builddir)
+    sources = []
+    for n in range(0, units):
+        source = 'unit%04d.cpp' % n
+        with open(os.path.join(builddir, source), 'wt') as oh:
+            oh.write(corpus_unit % {'n': n})
+        sources.append(source)
+    with open(os.path.join(builddir, 'main.cpp'), 'wt') as oh:
+        oh.write(corpus_main % {
+            'decls': ''.join('int test%04d(const char *s);\n' % n for n in range(0, units)),
+            'calls': ''.join('  ret += test%04d(s);\n' % n for n in range(0, units)),
+        })
+    sources.append('main.cpp')
+    return sources
+
+def failure(e):
+    output = getattr(e, "output", None)
+    return (output.decode('utf-8', 'replace') if output is not None else str(e))[:1000]
+
+def run(cmd):
+    subprocess.check_output(shlex.split(cmd, posix=(sys.platform != 'win32')), stderr=subprocess.STDOUT, cwd=builddir)
+
+def clean():
+    "Remove all build products, leaving only the sources"
+    for name in os.listdir(builddir):
+        if not name.endswith('.cpp'):
+            os.remove(os.path.join(builddir, name))
+
+def build(commands, opt, sources, jobs, extern_templates):
+    "Returns the seconds taken to compile the corpus from clean, the total object size, and the executable size"
+    clean()
+    defs = commands['define'] % 'OUTCOME_USE_EXTERN_TEMPLATES=1' if extern_templates else ''
+    objs = [os.path.splitext(source)[0] + commands['obj'] for source in sources]
+    cmds = [commands['compile'] % {'opt': opt, 'defs': defs, 'obj': obj, 'src': source} for source, obj in zip(sources, objs)]
+    begin = clock()
+    if ThreadPoolExecutor is not None and jobs > 1:
+        with ThreadPoolExecutor(max_workers=jobs) as executor:
+            for _ in executor.map(run, cmds):
+                pass
+    else:
+        for cmd in cmds:
+            run(cmd)
+    end = clock()
+    if extern_templates:
+        # The instantiations are built once into the library, not per build of its users
+        obj = 'extern_templates' + commands['obj']
+        run(commands['compile'] % {'opt': opt, 'defs': '', 'obj': obj, 'src': os.path.join('..', '..', 'src', 'extern_templates.cpp')})
+        objs.append(obj)
+    run(commands['link'] % {'exe': commands['exe'], 'objs': ' '.join(objs)})
+    objsize = sum(os.path.getsize(os.path.join(builddir, obj)) for obj in objs)
+    return end - begin, objsize, os.path.getsize(os.path.join(builddir, commands['exe']))
+
+parser = argparse.ArgumentParser(description='Build time and binary size with and without the extern template companion library')
+parser.add_argument('--units', type=int, default=64, help='Translation units in the corpus')
+parser.add_argument('--jobs', type=int, default=os.cpu_count() if hasattr(os, 'cpu_count') else 1, help='Translation units to compile concurrently')
+parser.add_argument('--repeats', type=int, default=3, help='Clean builds of each kind, of which the quickest is taken')
+parser.add_argument('--compiler', action='append', help='Only run the named compiler(s)')
+args = parser.parse_args()
+
+results = []
+sources = generate_sources(args.units)
+try:
+    for name, commands in compilers:
+        if args.compiler and name not in args.compiler:
+            continue
+        for opt in commands['opts']:
+            print("Building", len(sources), "translation units with", name, opt, "...")
+            try:
+                headers = min(build(commands, opt, sources, args.jobs, False) for n in range(0, args.repeats))
+                extern = min(build(commands, opt, sources, args.jobs, True) for n in range(0, args.repeats))
+            except (subprocess.CalledProcessError, OSError) as e:
+                print("Skipping", name, opt, "as it failed to compile:", failure(e))
+                continue
+            print("%s %s: header only %.3f secs, %d bytes of objects, %d byte executable" % ((name, opt) + headers))
+            print("%s %s: extern templates %.3f secs, %d bytes of objects, %d byte executable" % ((name, opt) + extern))
+            results.append((name, opt) + headers + extern)
+finally:
+    shutil.rmtree(builddir)
+
+with open('results-extern-templates-' + sys.platform + '.csv', 'wt') as resultsh:
+    resultsh.write('"Compiler","Optimisation","header-only-seconds","header-only-object-bytes","header-only-executable-bytes",'
+                   '"extern-templates-seconds","extern-templates-object-bytes","extern-templates-executable-bytes"\n')
+    for r in results:
+        resultsh.write('"%s","%s",%f,%d,%d,%f,%d,%d\n' % r)
@@ -0,0 +1,131 @@
+/* Harness shared by the standalone benchmarks
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+/* Each standalone benchmark times producing and then consuming ELEMENTS results, of which one
+in FAILURE_PERIOD is a failure, ITERATIONS times. Any of these may be defined before including
+this header.
+*/
+#ifndef ELEMENTS
+#define ELEMENTS (1 << 20)
+#endif
+#ifndef ITERATIONS
+#define ITERATIONS 16
+#endif
+#ifndef FAILURE_PERIOD
+#define FAILURE_PERIOD 1024
+#endif
+
+#include "../include/outcome.hpp"
+#include "timing.h"
+#include <stdio.h>
+
+#include <vector>
+
+static volatile int sink;
+
+// Spins for a second so the CPU has left any power saving state before anything is timed
+inline void warm_up()
+{
+  usCount start = GetUsCount();
+  while(GetUsCount() - start < 1 * 1000000000000LL)
+    ;
+}
+
+inline bool is_failure(int n)
+{
+  return (n % FAILURE_PERIOD) == FAILURE_PERIOD - 1;
+}
+
+// Not inlined, so the result is returned as any function returning one would
+template <class R, class F> QUICKCPPLIB_NOINLINE R produce(int n, F &&failure)
+{
+  using value_type = typename R::value_type;
+  if(is_failure(n))
+  {
+    return failure(n);
+  }
+  return R(OUTCOME_V2_NAMESPACE::in_place_type<value_type>, static_cast<value_type>(n));
+}
+
+// Appends ELEMENTS results to a vector, failures being made by failure(n)
+template <class Vector, class F> void fill(Vector &v, F &&failure)
+{
+  using R = std::decay_t<decltype(*v.begin())>;
+  for(int n = 0; n < ELEMENTS; n++)
+  {
+    v.push_back(produce<R>(n, failure));
+  }
+}
+
+template <class R, class F> std::vector<R> make(F &&failure)
+{
+  std::vector<R> ret;
+  ret.reserve(ELEMENTS);
+  fill(ret, failure);
+  return ret;
+}
+
+// Sums the values of the results into sink, counting each failure as -1
+template <class Vector> void consume(const Vector &v)
+{
+  int sum = 0;
+  for(const auto &r : v)
+  {
+    sum += r.has_value() ? (int) r.assume_value() : -1;
+  }
+  sink = sink + sum;
+}
+
+// The ticks per element of ITERATIONS calls of f, each of which produces or consumes ELEMENTS results
+template <class F> double ticks_per_element(F &&f)
+{
+  auto start = ticksclock();
+  for(int i = 0; i < ITERATIONS; i++)
+  {
+    f();
+  }
+  auto end = ticksclock();
+  return (double) (end - start) / ((double) ITERATIONS * ELEMENTS);
+}
+
+/* The ticks per observation of ITERATIONS calls of f(r), each of which makes the given number of
+observations. r is reached through a volatile pointer, so the compiler cannot hoist the observers
+out of the loop.
+*/
+template <class T, class F> double ticks_per_observation(const T &r, int observations, F &&f)
+{
+  const T *volatile p = &r;
+  auto start = ticksclock();
+  for(int i = 0; i < ITERATIONS; i++)
+  {
+    f(*p);
+  }
+  auto end = ticksclock();
+  return (double) (end - start) / ((double) observations * ITERATIONS);
+}
+
+#endif
@@ -0,0 +1,197 @@
+#!/usr/bin/python
+# Clean build time of importing the Outcome C++ module versus including its headers
+# (C) 2024 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2024
+#
+# Generates a corpus of translation units which each use result, outcome, the
+# policies and TRY, and builds it from clean twice: once including outcome.hpp,
+# and once building include/outcome.ixx and importing it. The module build time
+# includes building the module interface. Each build is linked and run, so a
+# module build which compiles but does not work is reported as failing.
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, argparse, shutil, time
+
+# Some Python 3 compatibility shims
+if sys.version_info.major < 3:
+    clock = time.clock
+else:
+    clock = time.perf_counter
+
+try:
+    from concurrent.futures import ThreadPoolExecutor
+except ImportError:
+    ThreadPoolExecutor = None
+
+corpus_unit = r'''#include "outcome.hpp"
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+namespace unit%(n)04d
+{
+  struct payload { int v[%(size)d]; };
+
+  outcome::result<payload> make(int x)
+  {
+    if(x < 0)
+    {
+      return std::errc::invalid_argument;
+    }
+    return payload{{x}};
+  }
+  outcome::checked<int> first(int x)
+  {
+    OUTCOME_TRY(auto &&p, make(x));
+    return p.v[0];
+  }
+  outcome::outcome<payload> wrap(int x)
+  {
+    OUTCOME_TRY(auto &&v, first(x));
+    return outcome::outcome<payload>(make(v));
+  }
+  outcome::result<void, std::error_code, outcome::policy::terminate> check(int x)
+  {
+    if(!wrap(x))
+    {
+      return outcome::failure(std::make_error_code(std::errc::io_error));
+    }
+    return outcome::success();
+  }
+}
+
+int test%(n)04d(int x)
+{
+  auto o = unit%(n)04d::wrap(x);
+  auto r = unit%(n)04d::check(x);
+  return (o.has_value() ? o.value().v[0] : o.error().value()) + (r ? 0 : 1);
+}
+'''
+
+if sys.platform == 'win32':
+    compilers = [
+        ('msvc', {
+            'headers': r'cl /nologo /std:c++20 /EHsc /c %(includes)s /Fo%(obj)s %(src)s',
+            'interface': [r'cl /nologo /std:c++20 /EHsc /c /interface %(includes)s /ifcOutput outcome.ifc /Fooutcome.o "%(ixx)s"'],
+            'module': r'cl /nologo /std:c++20 /EHsc /c /DOUTCOME_ENABLE_CXX_MODULES=1 %(includes)s /reference outcome=outcome.ifc /Fo%(obj)s %(src)s',
+            'link': r'cl /nologo /Fecorpus.exe %(objs)s',
+        }),
+    ]
+    executable = 'corpus.exe'
+else:
+    compilers = [
+        ('gcc', {
+            'headers': r'g++ -std=c++20 -c -o %(obj)s %(includes)s %(src)s',
+            'interface': [r'g++ -std=c++20 -fmodules-ts -c -o outcome.o %(includes)s -x c++ "%(ixx)s"'],
+            'module': r'g++ -std=c++20 -fmodules-ts -c -o %(obj)s -DOUTCOME_ENABLE_CXX_MODULES=1 %(includes)s %(src)s',
+            'link': r'g++ -o corpus %(objs)s',
+        }),
+        ('clang', {
+            'headers': r'clang++ -std=c++20 -c -o %(obj)s %(includes)s %(src)s',
+            'interface': [r'clang++ -std=c++20 --precompile -o outcome.pcm %(includes)s -x c++-module "%(ixx)s"', r'clang++ -std=c++20 -c -o outcome.o outcome.pcm'],
+            'module': r'clang++ -std=c++20 -c -o %(obj)s -DOUTCOME_ENABLE_CXX_MODULES=1 %(includes)s -fmodule-file=outcome=outcome.pcm %(src)s',
+            'link': r'clang++ -o corpus %(objs)s',
+        }),
+    ]
+    executable = './corpus'
+
+srcdir = os.path.dirname(os.path.abspath(__file__))
+builddir = 'module_build'
+
+def generate_sources(units):
+    "Generate the corpus of translation units, returning their paths"
+    if os.path.exists(builddir):
+        shutil.rmtree(builddir)
+    os.mkdir(builddir)
+    sources = []
+    for n in range(0, units):
+        source = 'unit%04d.cpp' % n
+        with open(os.path.join(builddir, source), 'wt') as oh:
+            oh.write(corpus_unit % {'n': n, 'size': 1 + (n % 4)})
+        sources.append(source)
+    # Calls every unit, each of which returns 1
+    with open(os.path.join(builddir, 'main.cpp'), 'wt') as oh:
+        for n in range(0, units):
+            oh.write('int test%04d(int x);\n' % n)
+        oh.write('int main()\n{\n  int ret = 0;\n')
+        for n in range(0, units):
+            oh.write('  ret += test%04d(1);\n' % n)
+        oh.write('  return ret != %d;\n}\n' % units)
+    sources.append('main.cpp')
+    return sources
+
+def failure(e):
+    output = getattr(e, "output", None)
+    return (output.decode('utf-8', 'replace') if output is not None else str(e))[:1000]
+
+def run(cmd):
+    subprocess.check_output(shlex.split(cmd, posix=(sys.platform != 'win32')), stderr=subprocess.STDOUT, cwd=builddir)
+
+def clean():
+    "Remove all build products, leaving only the sources"
+    for name in os.listdir(builddir):
+        if not name.endswith('.cpp'):
+            path = os.path.join(builddir, name)
+            if os.path.isdir(path):
+                shutil.rmtree(path)
+            else:
+                os.remove(path)
+
+def build(commands, sources, jobs, modules):
+    "Returns the seconds taken to build the corpus from clean, then links and runs it"
+    clean()
+    includes = ' '.join(('/I"%s"' if sys.platform == 'win32' else '-I"%s"') % d for d in include_dirs)
+    objs = [os.path.splitext(source)[0] + '.o' for source in sources]
+    cmds = [commands['module' if modules else 'headers'] % {'obj': obj, 'src': source, 'includes': includes} for obj, source in zip(objs, sources)]
+    begin = clock()
+    if modules:
+        for cmd in commands['interface']:
+            run(cmd % {'includes': includes, 'ixx': os.path.join(srcdir, '..', 'include', 'outcome.ixx')})
+        objs.append('outcome.o')
+    if ThreadPoolExecutor is not None and jobs > 1:
+        with ThreadPoolExecutor(max_workers=jobs) as executor:
+            for _ in executor.map(run, cmds):
+                pass
+    else:
+        for cmd in cmds:
+            run(cmd)
+    end = clock()
+    run(commands['link'] % {'objs': ' '.join(objs)})
+    run(executable)
+    return end - begin
+
+parser = argparse.ArgumentParser(description='Clean build time of importing the Outcome C++ module versus including its headers')
+parser.add_argument('--units', type=int, default=64, help='Translation units in the corpus')
+parser.add_argument('--jobs', type=int, default=os.cpu_count() if hasattr(os, 'cpu_count') else 1, help='Translation units to compile concurrently')
+parser.add_argument('--repeats', type=int, default=3, help='Clean builds of each kind, of which the quickest is taken')
+parser.add_argument('--compiler', action='append', help='Only run the named compiler(s)')
+parser.add_argument('--include-dir', action='append', help='Additional include directory, e.g. for quickcpplib')
+args = parser.parse_args()
+
+include_dirs = [os.path.join(srcdir, '..', 'include'), os.path.join(srcdir, '..', '..', 'quickcpplib', 'include')]
+include_dirs += [os.path.abspath(d) for d in (args.include_dir or [])]
+
+results = []
+sources = generate_sources(args.units)
+try:
+    for name, commands in compilers:
+        if args.compiler and name not in args.compiler:
+            continue
+        print("Building", len(sources), "translation units with", name, "...")
+        try:
+            headers = min(build(commands, sources, args.jobs, False) for n in range(0, args.repeats))
+        except (subprocess.CalledProcessError, OSError) as e:
+            print("Skipping", name, "as it failed to compile:", failure(e))
+            continue
+        try:
+            modules = min(build(commands, sources, args.jobs, True) for n in range(0, args.repeats))
+        except (subprocess.CalledProcessError, OSError) as e:
+            print("Skipping the module build of", name, "as it failed to compile:", failure(e))
+            modules = float('nan')
+        print("%s: headers %.3f secs, module %.3f secs, speedup %.2fx" % (name, headers, modules, headers / modules))
+        results.append((name, headers, modules, headers / modules))
+finally:
+    shutil.rmtree(builddir)
+
+with open('results-module-build-' + sys.platform + '.csv', 'wt') as resultsh:
+    resultsh.write('"Compiler","headers-seconds","module-seconds","speedup"\n')
+    for r in results:
+        resultsh.write('"%s",%f,%f,%f\n' % r)
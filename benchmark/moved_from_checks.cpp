@@ -0,0 +1,62 @@
+/* Benchmark of OUTCOME_ENABLE_MOVED_FROM_CHECKS overhead
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Build twice and compare the ticks per observation printed:
+
+g++ -std=c++17 -O3 -o unchecked moved_from_checks.cpp
+g++ -std=c++17 -O3 -DOUTCOME_ENABLE_MOVED_FROM_CHECKS=1 -o checked moved_from_checks.cpp
+*/
+
+#define ITERATIONS 10000000
+
+#include "harness.h"
+
+struct nontrivial
+{
+  int v;
+  explicit nontrivial(int _v)
+      : v(_v)
+  {
+  }
+  nontrivial(const nontrivial &o)
+      : v(o.v)
+  {
+  }
+  nontrivial(nontrivial &&o) noexcept
+      : v(o.v)
+  {
+  }
+  nontrivial &operator=(const nontrivial &) = default;
+  nontrivial &operator=(nontrivial &&) = default;
+  ~nontrivial() {}
+};
+
+int main(void)
+{
+  warm_up();
+  OUTCOME_V2_NAMESPACE::result<nontrivial> r(nontrivial(5));
+  printf("%s,%f\n", OUTCOME_ENABLE_MOVED_FROM_CHECKS ? "checked" : "unchecked",
+         ticks_per_observation(r, 2, [](const OUTCOME_V2_NAMESPACE::result<nontrivial> &v) { sink = sink + v.value().v + v.assume_value().v; }));
+  return 0;
+}
@@ -0,0 +1,102 @@
+/* Benchmark of growing a vector of outcomes by move construction against relocation
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Prints the ticks per element to grow, from empty, a std::vector of outcomes, and a minimal
+vector which relocates with realloc() if trait::is_trivially_relocatable<T>:
+
+g++ -std=c++17 -O3 -o relocation relocation.cpp
+*/
+
+#include "harness.h"
+#include <stdlib.h>
+
+// Only as much of a vector as growing one needs
+template <class T> class relocating_vector
+{
+  static_assert(OUTCOME_V2_NAMESPACE::trait::is_trivially_relocatable<T>::value, "T is not trivially relocatable");
+  T *_begin{nullptr};
+  size_t _size{0}, _capacity{0};
+
+public:
+  relocating_vector() = default;
+  relocating_vector(const relocating_vector &) = delete;
+  relocating_vector &operator=(const relocating_vector &) = delete;
+  ~relocating_vector()
+  {
+    clear();
+    free(_begin);
+  }
+  void clear() noexcept
+  {
+    for(size_t n = 0; n < _size; n++)
+    {
+      _begin[n].~T();
+    }
+    _size = 0;
+  }
+  void shrink_to_fit() noexcept
+  {
+    free(_begin);
+    _begin = nullptr;
+    _capacity = 0;
+  }
+  template <class U> void push_back(U &&v)
+  {
+    if(_size == _capacity)
+    {
+      _capacity = (_capacity == 0) ? 1 : _capacity * 2;
+      // Moving each element then destroying the old one is the same as copying their bytes
+      void *p = realloc(static_cast<void *>(_begin), _capacity * sizeof(T));
+      if(p == nullptr)
+      {
+        abort();
+      }
+      _begin = static_cast<T *>(p);
+    }
+    new(_begin + _size++) T(static_cast<U &&>(v));
+  }
+  const T *begin() const noexcept { return _begin; }
+  const T *end() const noexcept { return _begin + _size; }
+};
+
+template <class Vector> double run()
+{
+  Vector v;
+  return ticks_per_element([&] {
+    v.clear();
+    v.shrink_to_fit();
+    fill(v, [](int /*unused*/) { return std::make_error_code(std::errc::io_error); });
+    consume(v);
+  });
+}
+
+int main(void)
+{
+  warm_up();
+  using outcome = OUTCOME_V2_NAMESPACE::outcome<int>;
+  printf("Vector,Ticks per element\n");
+  printf("std::vector<outcome<int>>,%f\n", run<std::vector<outcome>>());
+  printf("relocating_vector<outcome<int>>,%f\n", run<relocating_vector<outcome>>());
+  return 0;
+}
@@ -24,43 +24,174 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "timing.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include "function.h"
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
 #include <exception>
 #endif
+#include <atomic>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #define ITERATIONS 100000
 
-extern volatile int counter;
-volatile int counter, forcereturn;
+/* Usage: runner [failure permille] [threads]
+
+FUNCTION(n) fails whenever failing is set, which is set before each call from a fixed
+pseudo-random sequence with the given permille of failures. The sources only consult it
+if generated by benchmark.py for a failure rate sweep. With no arguments failing is never
+set, and the loop and CPU affinity are those with which results-*.csv were measured.
+
+With more than one thread, each thread is pinned to its own CPU and runs the benchmark
+concurrently, and the mean of the ticks per iteration of each thread is printed. The sources
+must then be compiled with BENCHMARK_THREADED=1 so the counters are per thread.
+*/
+#if BENCHMARK_THREADED
+#define BENCHMARK_THREAD_LOCAL thread_local
+#else
+#define BENCHMARK_THREAD_LOCAL
+#endif
+
+extern BENCHMARK_THREAD_LOCAL volatile int counter, failing;
+BENCHMARK_THREAD_LOCAL volatile int counter, failing, forcereturn;
+
+static unsigned char failmask[ITERATIONS];
 
-int main(void)
+static void pin_to_cpu(unsigned cpu)
 {
 #ifdef _WIN32
-  SetThreadAffinityMask(GetCurrentThread(), 2ULL);
+  SetThreadAffinityMask(GetCurrentThread(), 1ULL << (cpu % 64));
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % CPU_SETSIZE, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void) cpu;
 #endif
+}
+
+int main(int argc, char *argv[])
+{
+  const bool sweep = (argc > 1);
+  const unsigned permille = sweep ? (unsigned) atoi(argv[1]) : 0;
+  const unsigned threads = (argc > 2 && atoi(argv[2]) > 1) ? (unsigned) atoi(argv[2]) : 1;
   {
-    usCount start=GetUsCount();
-    while(GetUsCount()-start<1*1000000000000LL);
+    // A fixed sequence, so every system fails on the same iterations
+    unsigned x = 1;
+    for(int n=0; n<ITERATIONS; n++)
+    {
+      x = x * 1103515245U + 12345U;
+      failmask[n] = ((x >> 16) % 1000) < permille;
+    }
   }
-  auto start = ticksclock();
-  for(int n=0; n<ITERATIONS; n++)
-  {
+  auto loop = [] {
+    for(int n=0; n<ITERATIONS; n++)
+    {
 #if !defined(_CPPUNWIND) && !defined(__EXCEPTIONS)
-    forcereturn += !FUNCTION(n);
+      forcereturn += !FUNCTION(n);
 #else
-    try
+      try
+      {
+        forcereturn += !FUNCTION(n);
+      }
+      catch(const std::exception &)
+      {
+      }
+#endif
+    }
+  };
+  auto sweep_loop = [] {
+    for(int n=0; n<ITERATIONS; n++)
     {
+      failing = failmask[n];
+#if !defined(_CPPUNWIND) && !defined(__EXCEPTIONS)
       forcereturn += !FUNCTION(n);
+#else
+      try
+      {
+        forcereturn += !FUNCTION(n);
+      }
+      catch(const std::exception &)
+      {
+      }
+#endif
+    }
+  };
+  if(threads > 1)
+  {
+    std::atomic<unsigned> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<double> ticks(threads);
+    std::vector<std::thread> workers;
+    for(unsigned t = 0; t < threads; t++)
+    {
+      workers.emplace_back([&, t] {
+        pin_to_cpu(t);
+        ++ready;
+        while(!go.load(std::memory_order_acquire))
+          ;
+        auto start = ticksclock();
+        sweep_loop();
+        auto end = ticksclock();
+        ticks[t] = (double) (end - start) / ITERATIONS;
+      });
+    }
+    while(ready != threads)
+      ;
+    {
+      usCount start=GetUsCount();
+      while(GetUsCount()-start<1*1000000000000LL);
     }
-    catch(const std::exception &)
+    go.store(true, std::memory_order_release);
+    double total = 0;
+    for(unsigned t = 0; t < threads; t++)
     {
+      workers[t].join();
+      total += ticks[t];
     }
+    printf("%f\n", total / threads);
+    return 0;
+  }
+#ifndef _WIN32
+  if(sweep)
 #endif
+    pin_to_cpu(1);
+  auto run = [&] {
+    if(sweep)
+      sweep_loop();
+    else
+      loop();
+  };
+  {
+    usCount start=GetUsCount();
+    while(GetUsCount()-start<1*1000000000000LL);
   }
+  auto start = ticksclock();
+  run();
   auto end = ticksclock();
   double ticks=end-start;
   ticks/=ITERATIONS;
   printf("%f\n", ticks);
+  // Counted in a second run, so reading the counters does not disturb the ticks
+  perf_counters counters;
+  if(counters.any_available())
+  {
+    counters.start();
+    run();
+    counters.stop();
+    for(int n = 0; n < perf_counters::count; n++)
+    {
+      if(n > 0)
+        printf(",");
+      if(counters.available(n))
+        printf("%f", counters.value[n] / ITERATIONS);
+    }
+    printf("\n");
+  }
   return 0;
 }
@@ -0,0 +1,608 @@
+/* Micro-benchmark suite of result and outcome operations
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Times each operation below for each error handling system, for each payload, and prints one
+row of ticks per operation in the same CSV format as benchmark.py, so rows from different
+compilers and configurations can be appended to a single file:
+
+suite [label] [results.csv]
+
+If the CSV file exists its header must match, and a row is appended. Operations which a
+system or configuration does not support are left empty, as exception-throw is for the
+noexcept rows of results-linux2.csv. Where hardware performance counters are available,
+the counts per operation are likewise written to results-counters.csv.
+*/
+
+#include "../include/outcome.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include("../include/outcome/experimental/status-code/include/status-code/system_error2.hpp") || __has_include(<status-code/system_error2.hpp>)
+#include "../include/outcome/experimental/status_result.hpp"
+#define OUTCOME_BENCHMARK_HAVE_STATUS_RESULT 1
+#endif
+#if __has_include(<expected>) && __cplusplus > 202002L
+#include <expected>
+#ifdef __cpp_lib_expected
+#define OUTCOME_BENCHMARK_HAVE_EXPECTED 1
+#endif
+#endif
+#endif
+#ifndef OUTCOME_BENCHMARK_HAVE_STATUS_RESULT
+#define OUTCOME_BENCHMARK_HAVE_STATUS_RESULT 0
+#endif
+#ifndef OUTCOME_BENCHMARK_HAVE_EXPECTED
+#define OUTCOME_BENCHMARK_HAVE_EXPECTED 0
+#endif
+
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+#define OUTCOME_BENCHMARK_HAVE_EXCEPTIONS 1
+#else
+#define OUTCOME_BENCHMARK_HAVE_EXCEPTIONS 0
+#endif
+
+#ifdef _MSC_VER
+#define OUTCOME_BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define OUTCOME_BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+#define ITERATIONS 100000
+#define REPETITIONS 5
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+volatile int sink;
+
+// Makes the compiler assume v was read and modified, without generating any code
+template <class T> inline void escape(T &v)
+{
+#ifdef _MSC_VER
+  static const void *volatile p;
+  p = &v;
+#else
+  asm volatile("" : : "g"(&v) : "memory");
+#endif
+}
+
+/*************************************************************************************************
+ * Payloads
+ *************************************************************************************************/
+
+// Trivially copyable, and so stored in trivial storage by result and outcome
+template <size_t Bytes> struct trivial_payload
+{
+  int v[Bytes / sizeof(int)];
+  friend bool operator==(const trivial_payload &a, const trivial_payload &b) { return memcmp(a.v, b.v, sizeof(a.v)) == 0; }
+  friend bool operator!=(const trivial_payload &a, const trivial_payload &b) { return !(a == b); }
+};
+
+// Nontrivial copy, move and destruction, and so stored in nontrivial storage by result and outcome
+template <size_t Bytes> struct nontrivial_payload
+{
+  int v[Bytes / sizeof(int)];
+  nontrivial_payload() { memset(v, 0, sizeof(v)); }
+  nontrivial_payload(const nontrivial_payload &o) { memcpy(v, o.v, sizeof(v)); }
+  nontrivial_payload(nontrivial_payload &&o) noexcept { memcpy(v, o.v, sizeof(v)); }
+  nontrivial_payload &operator=(const nontrivial_payload &o)
+  {
+    memcpy(v, o.v, sizeof(v));
+    return *this;
+  }
+  nontrivial_payload &operator=(nontrivial_payload &&o) noexcept
+  {
+    memcpy(v, o.v, sizeof(v));
+    return *this;
+  }
+  ~nontrivial_payload() { escape(v); }
+  friend bool operator==(const nontrivial_payload &a, const nontrivial_payload &b) { return memcmp(a.v, b.v, sizeof(a.v)) == 0; }
+  friend bool operator!=(const nontrivial_payload &a, const nontrivial_payload &b) { return !(a == b); }
+};
+
+inline int first(int v) { return v; }
+template <class T> inline int first(const T &v) { return v.v[0]; }
+
+template <class T> struct payload_name;
+template <> struct payload_name<int>
+{
+  static const char *get() { return "int"; }
+};
+template <> struct payload_name<trivial_payload<16>>
+{
+  static const char *get() { return "t16"; }
+};
+template <> struct payload_name<trivial_payload<256>>
+{
+  static const char *get() { return "t256"; }
+};
+template <> struct payload_name<nontrivial_payload<16>>
+{
+  static const char *get() { return "n16"; }
+};
+template <> struct payload_name<nontrivial_payload<256>>
+{
+  static const char *get() { return "n256"; }
+};
+
+/*************************************************************************************************
+ * Error handling systems
+ *************************************************************************************************/
+
+// A result-like type whose failure is propagated by OUTCOME_TRY
+template <class Type, class Derived> struct tryable_system
+{
+  using type = Type;
+  using value_type = typename type::value_type;
+
+  static OUTCOME_BENCHMARK_NOINLINE type produce(const value_type &v, bool fail)
+  {
+    if(fail)
+    {
+      return Derived::error();
+    }
+    return v;
+  }
+  static OUTCOME_BENCHMARK_NOINLINE type propagate(const value_type &v, bool fail)
+  {
+    OUTCOME_TRY(auto &&x, produce(v, fail));
+    return type(outcome::in_place_type<value_type>, static_cast<decltype(x) &&>(x));
+  }
+  static bool try_op(const value_type &v, bool fail) { return propagate(v, fail).has_value(); }
+  static const value_type &observe(const type &r) { return r.value(); }
+};
+
+template <class T> struct result_system : tryable_system<outcome::result<T>, result_system<T>>
+{
+  static constexpr bool available = true;
+  static const char *name() { return "result"; }
+  static outcome::result<T> error() { return std::make_error_code(std::errc::io_error); }
+};
+
+template <class T> struct outcome_system : tryable_system<outcome::outcome<T>, outcome_system<T>>
+{
+  static constexpr bool available = true;
+  static const char *name() { return "outcome"; }
+  static outcome::outcome<T> error() { return std::make_error_code(std::errc::io_error); }
+};
+
+#if OUTCOME_BENCHMARK_HAVE_STATUS_RESULT
+template <class T> struct status_result_system : tryable_system<outcome::experimental::status_result<T>, status_result_system<T>>
+{
+  static constexpr bool available = true;
+  static const char *name() { return "status-result"; }
+  static outcome::experimental::status_result<T> error() { return outcome::experimental::errc::io_error; }
+};
+#endif
+
+#if OUTCOME_BENCHMARK_HAVE_EXPECTED
+template <class T> struct expected_system
+{
+  static constexpr bool available = true;
+  static const char *name() { return "expected"; }
+  using type = std::expected<T, std::error_code>;
+  using value_type = T;
+  static type error() { return std::unexpected(std::make_error_code(std::errc::io_error)); }
+  static OUTCOME_BENCHMARK_NOINLINE type produce(const value_type &v, bool fail)
+  {
+    if(fail)
+    {
+      return error();
+    }
+    return v;
+  }
+  static OUTCOME_BENCHMARK_NOINLINE type propagate(const value_type &v, bool fail)
+  {
+    auto r = produce(v, fail);
+    if(!r)
+    {
+      return std::unexpected(std::move(r).error());
+    }
+    return type(std::in_place, std::move(*r));
+  }
+  static bool try_op(const value_type &v, bool fail) { return propagate(v, fail).has_value(); }
+  static const value_type &observe(const type &r) { return r.value(); }
+};
+#endif
+
+#if OUTCOME_BENCHMARK_HAVE_EXCEPTIONS
+// The value is returned directly, and failure is a thrown std::system_error
+template <class T> struct exception_system
+{
+  static constexpr bool available = true;
+  static const char *name() { return "exception"; }
+  using type = T;
+  using value_type = T;
+  static type error()
+  {
+    try
+    {
+      throw std::system_error(std::make_error_code(std::errc::io_error));
+    }
+    catch(const std::system_error &)
+    {
+      return T{};
+    }
+  }
+  static OUTCOME_BENCHMARK_NOINLINE type produce(const value_type &v, bool fail)
+  {
+    if(fail)
+    {
+      throw std::system_error(std::make_error_code(std::errc::io_error));
+    }
+    return v;
+  }
+  static OUTCOME_BENCHMARK_NOINLINE type propagate(const value_type &v, bool fail) { return produce(v, fail); }
+  static bool try_op(const value_type &v, bool fail)
+  {
+    try
+    {
+      (void) propagate(v, fail);
+      return true;
+    }
+    catch(const std::system_error &)
+    {
+      return false;
+    }
+  }
+  static const value_type &observe(const type &r) { return r; }
+};
+#endif
+
+// Stands in for a system not available in this configuration, so the CSV columns are always the same
+template <const char *(*Name)()> struct unavailable_system
+{
+  template <class T> struct of
+  {
+    static constexpr bool available = false;
+    static const char *name() { return Name(); }
+  };
+};
+inline const char *status_result_name() { return "status-result"; }
+inline const char *expected_name() { return "expected"; }
+inline const char *exception_name() { return "exception"; }
+#if !OUTCOME_BENCHMARK_HAVE_STATUS_RESULT
+template <class T> using status_result_system = unavailable_system<status_result_name>::of<T>;
+#endif
+#if !OUTCOME_BENCHMARK_HAVE_EXPECTED
+template <class T> using expected_system = unavailable_system<expected_name>::of<T>;
+#endif
+#if !OUTCOME_BENCHMARK_HAVE_EXCEPTIONS
+template <class T> using exception_system = unavailable_system<exception_name>::of<T>;
+#endif
+
+/*************************************************************************************************
+ * Operations
+ *************************************************************************************************/
+
+struct measurement
+{
+  double ticks;
+  double counts[perf_counters::count];
+};
+
+perf_counters *counters;
+
+template <class F> measurement measure(F &&f)
+{
+  measurement ret{};
+  for(int rep = 0; rep < REPETITIONS; rep++)
+  {
+    auto start = ticksclock();
+    for(int n = 0; n < ITERATIONS; n++)
+    {
+      f();
+    }
+    auto end = ticksclock();
+    double ticks = (double) (end - start) / ITERATIONS;
+    if(rep == 0 || ticks < ret.ticks)
+    {
+      ret.ticks = ticks;
+    }
+  }
+  // Counted in a separate run, so reading the counters does not disturb the ticks
+  if(counters->any_available())
+  {
+    counters->start();
+    for(int n = 0; n < ITERATIONS; n++)
+    {
+      f();
+    }
+    counters->stop();
+    for(int n = 0; n < perf_counters::count; n++)
+    {
+      ret.counts[n] = counters->value[n] / ITERATIONS;
+    }
+  }
+  return ret;
+}
+
+struct column
+{
+  std::string name;
+  bool available;
+  measurement m;
+};
+
+template <class S, class T> struct operations
+{
+  using type = typename S::type;
+
+  static measurement value()
+  {
+    T v{};
+    return measure([&] {
+      escape(v);
+      type r(v);
+      escape(r);
+    });
+  }
+  static measurement error()
+  {
+    return measure([&] {
+      type r(S::error());
+      escape(r);
+    });
+  }
+  static measurement copy()
+  {
+    type r(T{});
+    return measure([&] {
+      escape(r);
+      type c(r);
+      escape(c);
+    });
+  }
+  static measurement move()
+  {
+    type r(T{});
+    return measure([&] {
+      escape(r);
+      type c(std::move(r));
+      escape(c);
+    });
+  }
+  static measurement swap()
+  {
+    type a(T{}), b(T{});
+    return measure([&] {
+      using std::swap;
+      swap(a, b);
+      escape(a);
+      escape(b);
+    });
+  }
+  static measurement compare()
+  {
+    type a(T{}), b(T{});
+    return measure([&] {
+      escape(a);
+      escape(b);
+      sink = (a == b);
+    });
+  }
+  static measurement observe()
+  {
+    type r(T{});
+    return measure([&] {
+      escape(r);
+      sink = first(S::observe(r));
+    });
+  }
+  static measurement try_value()
+  {
+    T v{};
+    return measure([&] { sink = S::try_op(v, false); });
+  }
+  static measurement try_error()
+  {
+    T v{};
+    return measure([&] { sink = S::try_op(v, true); });
+  }
+
+  static void run(std::vector<column> &out)
+  {
+    std::string prefix = std::string(S::name()) + "-";
+    std::string suffix = std::string("-") + payload_name<T>::get();
+    out.push_back({prefix + "value" + suffix, true, value()});
+    out.push_back({prefix + "error" + suffix, true, error()});
+    out.push_back({prefix + "copy" + suffix, true, copy()});
+    out.push_back({prefix + "move" + suffix, true, move()});
+    out.push_back({prefix + "swap" + suffix, true, swap()});
+    out.push_back({prefix + "compare" + suffix, true, compare()});
+    out.push_back({prefix + "observe" + suffix, true, observe()});
+    out.push_back({prefix + "try-value" + suffix, true, try_value()});
+    out.push_back({prefix + "try-error" + suffix, true, try_error()});
+  }
+};
+
+template <class S, bool = S::available> struct run_system
+{
+  template <class T> static void run(std::vector<column> &out) { operations<S, T>::run(out); }
+};
+template <class S> struct run_system<S, false>
+{
+  template <class T> static void run(std::vector<column> &out)
+  {
+    static const char *ops[] = {"value", "error", "copy", "move", "swap", "compare", "observe", "try-value", "try-error"};
+    for(const char *op : ops)
+    {
+      out.push_back({std::string(S::name()) + "-" + op + "-" + payload_name<T>::get(), false, {}});
+    }
+  }
+};
+
+template <class T> void run_payload(std::vector<column> &out)
+{
+  run_system<result_system<T>>::template run<T>(out);
+  run_system<outcome_system<T>>::template run<T>(out);
+  run_system<status_result_system<T>>::template run<T>(out);
+  run_system<expected_system<T>>::template run<T>(out);
+  run_system<exception_system<T>>::template run<T>(out);
+}
+
+static std::string default_label()
+{
+  char buffer[64];
+#if defined(__clang__)
+  snprintf(buffer, sizeof(buffer), "clang%d%d", __clang_major__, __clang_minor__);
+#elif defined(__GNUC__)
+  snprintf(buffer, sizeof(buffer), "gcc%d%d", __GNUC__, __GNUC_MINOR__);
+#elif defined(_MSC_VER)
+  snprintf(buffer, sizeof(buffer), "msvc%d", _MSC_VER);
+#else
+  snprintf(buffer, sizeof(buffer), "unknown");
+#endif
+  std::string ret(buffer);
+  if(!OUTCOME_BENCHMARK_HAVE_EXCEPTIONS)
+  {
+    ret.append("-noexcept");
+  }
+  return ret;
+}
+
+// Appends row to the CSV file at path, first writing header if the file is new
+static bool append_csv(const char *path, const std::string &header, const std::string &row)
+{
+  bool write_header = true;
+  if(FILE *ih = fopen(path, "rt"))
+  {
+    std::string existing;
+    char buffer[4096];
+    while(fgets(buffer, sizeof(buffer), ih) != nullptr)
+    {
+      existing.append(buffer);
+      if(!existing.empty() && existing.back() == '\n')
+      {
+        break;
+      }
+    }
+    fclose(ih);
+    if(!existing.empty())
+    {
+      while(!existing.empty() && (existing.back() == '\n' || existing.back() == '\r'))
+      {
+        existing.pop_back();
+      }
+      if(existing != header)
+      {
+        fprintf(stderr, "FATAL: %s has different columns to this benchmark suite\n", path);
+        return false;
+      }
+      write_header = false;
+    }
+  }
+  FILE *oh = fopen(path, "at");
+  if(oh == nullptr)
+  {
+    fprintf(stderr, "FATAL: could not open %s for writing\n", path);
+    return false;
+  }
+  if(write_header)
+  {
+    fprintf(oh, "%s\n", header.c_str());
+  }
+  fprintf(oh, "%s\n", row.c_str());
+  fclose(oh);
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  const std::string label = (argc > 1) ? argv[1] : default_label();
+  const char *csvpath = (argc > 2) ? argv[2] : nullptr;
+#ifdef _WIN32
+  SetThreadAffinityMask(GetCurrentThread(), 2ULL);
+#endif
+  {
+    usCount start = GetUsCount();
+    while(GetUsCount() - start < 1 * 1000000000000LL)
+      ;
+  }
+
+  perf_counters _counters;
+  counters = &_counters;
+  std::vector<column> columns;
+  run_payload<int>(columns);
+  run_payload<trivial_payload<16>>(columns);
+  run_payload<trivial_payload<256>>(columns);
+  run_payload<nontrivial_payload<16>>(columns);
+  run_payload<nontrivial_payload<256>>(columns);
+
+  char buffer[64];
+  std::string header("\"Compiler\""), row("\"" + label + "\"");
+  std::string counters_header("\"Compiler\""), counters_row("\"" + label + "\"");
+  for(const auto &c : columns)
+  {
+    header.append(",\"" + c.name + "\"");
+    row.push_back(',');
+    if(c.available)
+    {
+      snprintf(buffer, sizeof(buffer), "%f", c.m.ticks);
+      row.append(buffer);
+    }
+    for(int n = 0; n < perf_counters::count; n++)
+    {
+      counters_header.append(",\"" + c.name + "-" + perf_counters::name(n) + "\"");
+      counters_row.push_back(',');
+      if(c.available && counters->available(n))
+      {
+        snprintf(buffer, sizeof(buffer), "%f", c.m.counts[n]);
+        counters_row.append(buffer);
+      }
+    }
+  }
+
+  if(csvpath == nullptr)
+  {
+    printf("%s\n%s\n", header.c_str(), row.c_str());
+    if(counters->any_available())
+    {
+      printf("\n%s\n%s\n", counters_header.c_str(), counters_row.c_str());
+    }
+    return 0;
+  }
+  if(!append_csv(csvpath, header, row))
+  {
+    return 1;
+  }
+  printf("%s\n", row.c_str());
+  if(counters->any_available())
+  {
+    std::string counterspath(csvpath);
+    const auto dot = counterspath.rfind(".csv");
+    counterspath.insert((dot == std::string::npos) ? counterspath.size() : dot, "-counters");
+    if(!append_csv(counterspath.c_str(), counters_header, counters_row))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define TIMING_H
 
 #include <stdint.h>
+#include <string.h>
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
@@ -99,6 +100,141 @@ inline uint64_t ticksclock()
   return rdtscp();
 }
 
+
+/* Hardware performance counters, read around a benchmark loop. On Linux these come from
+perf_event_open(), elsewhere or where perf events are not permitted (see
+/proc/sys/kernel/perf_event_paranoid) or not supported (many VMs) each counter is simply
+unavailable, and the benchmark reports ticks alone.
+*/
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+struct perf_counters
+{
+  enum
+  {
+    instructions,
+    cycles,
+    branch_misses,
+    l1d_misses,
+    count
+  };
+  static const char *name(int idx)
+  {
+    static const char *names[count] = {"instructions", "cycles", "branch-misses", "l1d-misses"};
+    return names[idx];
+  }
+
+  int fd[count];
+  double value[count];  // as of the last stop(), scaled if the kernel had to multiplex the counters
+
+  perf_counters()
+  {
+    for(int n = 0; n < count; n++)
+    {
+      fd[n] = -1;
+      value[n] = 0;
+    }
+#if defined(__linux__)
+    static const struct
+    {
+      uint32_t type;
+      uint64_t config;
+    } events[count] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    };
+    for(int n = 0; n < count; n++)
+    {
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = events[n].type;
+      attr.config = events[n].config;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fd[n] = (int) syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+#endif
+  }
+  perf_counters(const perf_counters &) = delete;
+  perf_counters &operator=(const perf_counters &) = delete;
+  ~perf_counters()
+  {
+#if defined(__linux__)
+    for(int n = 0; n < count; n++)
+    {
+      if(fd[n] >= 0)
+      {
+        close(fd[n]);
+      }
+    }
+#endif
+  }
+
+  bool available(int idx) const { return fd[idx] >= 0; }
+  bool any_available() const
+  {
+    for(int n = 0; n < count; n++)
+    {
+      if(available(n))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void start()
+  {
+#if defined(__linux__)
+    for(int n = 0; n < count; n++)
+    {
+      if(fd[n] >= 0)
+      {
+        ioctl(fd[n], PERF_EVENT_IOC_RESET, 0);
+      }
+    }
+    for(int n = 0; n < count; n++)
+    {
+      if(fd[n] >= 0)
+      {
+        ioctl(fd[n], PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+  void stop()
+  {
+#if defined(__linux__)
+    for(int n = 0; n < count; n++)
+    {
+      if(fd[n] >= 0)
+      {
+        ioctl(fd[n], PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+    for(int n = 0; n < count; n++)
+    {
+      value[n] = 0;
+      uint64_t buffer[3];  // value, time enabled, time running
+      if(fd[n] >= 0 && read(fd[n], buffer, sizeof(buffer)) == (ssize_t) sizeof(buffer) && buffer[2] > 0)
+      {
+        value[n] = (double) buffer[0] * ((double) buffer[1] / (double) buffer[2]);
+      }
+    }
+#endif
+  }
+};
+
 #if defined(__cplusplus) && 0
 #include <chrono>
 #include <iostream>
@@ -6,6 +6,9 @@ set(outcome_HEADERS
   "include/outcome/basic_result.hpp"
   "include/outcome/boost_outcome.hpp"
   "include/outcome/boost_result.hpp"
+  "include/outcome/boxed_error.hpp"
+  "include/outcome/compact_error_code.hpp"
+  "include/outcome/compact_result.hpp"
   "include/outcome/config.hpp"
   "include/outcome/convert.hpp"
   "include/outcome/coroutine_support.hpp"
@@ -17,12 +20,21 @@ set(outcome_HEADERS
   "include/outcome/detail/basic_result_storage.hpp"
   "include/outcome/detail/basic_result_value_observers.hpp"
   "include/outcome/detail/coroutine_support.ipp"
+  "include/outcome/detail/exception_registry.hpp"
+  "include/outcome/detail/failure_hooks.hpp"
+  "include/outcome/detail/failure_info.hpp"
+  "include/outcome/detail/moved_from_checks.hpp"
   "include/outcome/detail/revision.hpp"
+  "include/outcome/detail/throw_sites.hpp"
   "include/outcome/detail/trait_std_error_code.hpp"
   "include/outcome/detail/trait_std_exception.hpp"
   "include/outcome/detail/try.h"
+  "include/outcome/detail/usdt.hpp"
   "include/outcome/detail/value_storage.hpp"
   "include/outcome/detail/version.hpp"
+  "include/outcome/error_metrics.hpp"
+  "include/outcome/error_trace.hpp"
+  "include/outcome/exclusive_outcome.hpp"
   "include/outcome/experimental/coroutine_support.hpp"
   "include/outcome/experimental/result.h"
   "include/outcome/experimental/status-code/include/status-code/boost_error_code.hpp"
@@ -53,10 +65,12 @@ set(outcome_HEADERS
   "include/outcome/experimental/status-code/single-header/system_error2.hpp"
   "include/outcome/experimental/status_outcome.hpp"
   "include/outcome/experimental/status_result.hpp"
+  "include/outcome/extern_templates.hpp"
   "include/outcome/iostream_support.hpp"
   "include/outcome/outcome.hpp"
   "include/outcome/outcome.natvis"
   "include/outcome/outcome_gdb.h"
+  "include/outcome/payload_table.hpp"
   "include/outcome/policy/all_narrow.hpp"
   "include/outcome/policy/base.hpp"
   "include/outcome/policy/fail_to_compile_observers.hpp"
@@ -67,9 +81,11 @@ set(outcome_HEADERS
   "include/outcome/policy/terminate.hpp"
   "include/outcome/policy/throw_bad_result_access.hpp"
   "include/outcome/result.hpp"
+  "include/outcome/sampled_backtrace.hpp"
   "include/outcome/std_outcome.hpp"
   "include/outcome/std_result.hpp"
   "include/outcome/success_failure.hpp"
+  "include/outcome/sysresult.hpp"
   "include/outcome/trait.hpp"
   "include/outcome/try.hpp"
   "include/outcome/utils.hpp"
@@ -2,6 +2,9 @@
 set(outcome_TESTS
   "test/expected-pass.cpp"
   "test/single-header-test.cpp"
+  "test/tests/boxed-error.cpp"
+  "test/tests/compact-error-code.cpp"
+  "test/tests/compact-result.cpp"
   "test/tests/comparison.cpp"
   "test/tests/constexpr.cpp"
   "test/tests/containers.cpp"
@@ -9,11 +12,18 @@ set(outcome_TESTS
   "test/tests/core-result.cpp"
   "test/tests/coroutine-support.cpp"
   "test/tests/default-construction.cpp"
+  "test/tests/emplace.cpp"
+  "test/tests/error-from-exception.cpp"
+  "test/tests/error-metrics.cpp"
+  "test/tests/error-trace.cpp"
+  "test/tests/exclusive-outcome.cpp"
   "test/tests/experimental-c-result.cpp"
   "test/tests/experimental-core-outcome-status.cpp"
   "test/tests/experimental-core-result-status.cpp"
   "test/tests/experimental-p0709a.cpp"
+  "test/tests/experimental-sysresult.cpp"
   "test/tests/fileopen.cpp"
+  "test/tests/force-inline-observers.cpp"
   "test/tests/hooks.cpp"
   "test/tests/issue0007.cpp"
   "test/tests/issue0009.cpp"
@@ -38,12 +48,19 @@ set(outcome_TESTS
   "test/tests/issue0255.cpp"
   "test/tests/issue0259.cpp"
   "test/tests/issue0291.cpp"
+  "test/tests/moved-from-checks.cpp"
   "test/tests/noexcept-propagation.cpp"
+  "test/tests/payload-table.cpp"
   "test/tests/propagate.cpp"
+  "test/tests/reference-result.cpp"
+  "test/tests/sampled-backtrace.cpp"
   "test/tests/serialisation.cpp"
   "test/tests/success-failure.cpp"
   "test/tests/swap.cpp"
+  "test/tests/sysresult.cpp"
+  "test/tests/trivially-relocatable.cpp"
   "test/tests/udts.cpp"
+  "test/tests/usdt.cpp"
   "test/tests/value-or-error.cpp"
 )
 # DO NOT EDIT, GENERATED BY SCRIPT
@@ -55,4 +72,6 @@ set(outcome_COMPILE_FAIL_TESTS
   "test/compile-fail/outcome-int-int-1.cpp"
   "test/compile-fail/result-int-int-1.cpp"
   "test/compile-fail/result-int-int-2.cpp"
+  "test/compile-fail/sysresult-negative-value.cpp"
+  "test/compile-fail/sysresult-zero-errno.cpp"
 )
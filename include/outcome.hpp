@@ -26,8 +26,21 @@ Distributed under the Boost Software License, Version 1.0.
 #include "outcome/coroutine_support.hpp"
 #include "outcome/iostream_support.hpp"
 #include "outcome/try.hpp"
+#if OUTCOME_USE_EXTERN_TEMPLATES
+#include "outcome/extern_templates.hpp"
+#endif
 #else
+// The standard library types used by Outcome's API are not exported from the module
+#include <exception>
+#include <initializer_list>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
 #include "outcome/try.hpp"
 
-import OUTCOME_V2_CXX_MODULE_NAME;
+import outcome;
 #endif
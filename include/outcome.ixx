@@ -1,11 +1,63 @@
 module;
+// Everything Outcome includes which is not Outcome goes into the global module fragment,
+// so it is not attached to the Outcome module and does not clash with the same headers
+// being included by the importing translation unit.
+#ifdef _MSC_VER
 #include <__msvc_all_public_headers.hpp>
-// *** Everything before here is replaced by cmake!
+#else
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <iosfwd>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#if __has_include(<coroutine>)
+#include <coroutine>
+#endif
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
+#endif
 
 // Tell the headers we are generating the interface for the library
 #define GENERATING_OUTCOME_MODULE_INTERFACE
 
+// Macros cannot be exported from a module, so the TRY macros and what they use are
+// included textually by both this interface and the importing translation unit
 #include "outcome/try.hpp"
 
-export module OUTCOME_V2_CXX_MODULE_NAME;
+// status_result is only part of the module if status-code is available
+#if !OUTCOME_USE_SYSTEM_STATUS_CODE && __has_include("outcome/experimental/status-code/include/status-code/system_error2.hpp")
+#define OUTCOME_MODULE_INCLUDES_STATUS_RESULT 1
+#if !defined(SYSTEM_ERROR2_USE_STD_ADDRESSOF) && OUTCOME_USE_STD_ADDRESSOF
+#define SYSTEM_ERROR2_USE_STD_ADDRESSOF 1
+#endif
+#include "outcome/experimental/status-code/include/status-code/system_error2.hpp"
+#elif __has_include(<status-code/system_error2.hpp>)
+#define OUTCOME_MODULE_INCLUDES_STATUS_RESULT 1
+#if !defined(SYSTEM_ERROR2_USE_STD_ADDRESSOF) && OUTCOME_USE_STD_ADDRESSOF
+#define SYSTEM_ERROR2_USE_STD_ADDRESSOF 1
+#endif
+#include <status-code/system_error2.hpp>
+#endif
+
+export module outcome;
+
 #include "outcome.hpp"
+#if OUTCOME_MODULE_INCLUDES_STATUS_RESULT
+#include "outcome/experimental/status_outcome.hpp"
+#endif
@@ -161,6 +161,52 @@ namespace detail
     return static_cast<failure_type<U, void> &&>(v).error();
   }
 
+  /* Where basic_outcome keeps its exception. Usually a member after the state of the result, but if the
+  no-value policy is a policy::exclusive_exception, the state holds it in place of the value or the error.
+  */
+  struct basic_outcome_exception_if_tag
+  {
+  };
+  template <class P, bool Exclusive> struct basic_outcome_exception_storage
+  {
+    devoid<P> _ptr;
+
+    basic_outcome_exception_storage() = default;
+    template <class State, class... Args>
+    constexpr explicit basic_outcome_exception_storage(State & /*unused*/, Args &&...args) noexcept(detail::is_nothrow_constructible<devoid<P>, Args...>)
+        : _ptr(static_cast<Args &&>(args)...)
+    {
+    }
+    template <class State, class U>
+    constexpr basic_outcome_exception_storage(State & /*unused*/, basic_outcome_exception_if_tag /*unused*/, bool /*unused*/,
+                                              U &&v) noexcept(detail::is_nothrow_constructible<devoid<P>, U>)
+        : _ptr(static_cast<U &&>(v))
+    {
+    }
+    template <class State> constexpr devoid<P> &_get(State & /*unused*/) noexcept { return _ptr; }
+    template <class State> constexpr const devoid<P> &_get(const State & /*unused*/) const noexcept { return _ptr; }
+    template <class State, class U> constexpr void _assign(State & /*unused*/, U &&v) { _ptr = static_cast<U &&>(v); }
+  };
+  template <class P> struct basic_outcome_exception_storage<P, true>
+  {
+    basic_outcome_exception_storage() = default;
+    template <class State, class... Args> explicit basic_outcome_exception_storage(State &state, Args &&...args)
+    {
+      state._emplace_exception(static_cast<Args &&>(args)...);
+    }
+    // The state was converted already, so only an exception held outside the source's state remains to be added
+    template <class State, class U> basic_outcome_exception_storage(State &state, basic_outcome_exception_if_tag /*unused*/, bool have_exception, U &&v)
+    {
+      if(have_exception)
+      {
+        state._emplace_exception(static_cast<U &&>(v));
+      }
+    }
+    template <class State> static constexpr P &_get(State &state) noexcept { return state._exception; }
+    template <class State> static constexpr const P &_get(const State &state) noexcept { return state._exception; }
+    template <class State, class U> static void _assign(State &state, U &&v) { state._assign_exception(static_cast<U &&>(v)); }
+  };
+
   template <class T> struct is_basic_outcome
   {
     static constexpr bool value = false;
@@ -178,7 +224,7 @@ template <class T> using is_basic_outcome = detail::is_basic_outcome<std::decay_
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
+template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
 
 namespace concepts
 {
@@ -211,7 +257,7 @@ namespace concepts
     inline OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, NVP> match_basic_outcome(OUTCOME_V2_NAMESPACE::basic_outcome<R, S, P, NVP> &&, T &&);
 
     template <class U>
-    static constexpr bool basic_outcome =
+    OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool basic_outcome =
     OUTCOME_V2_NAMESPACE::is_basic_outcome<U>::value ||
     !std::is_same<no_match, decltype(match_basic_outcome(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>(),
                                                          std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
@@ -219,7 +265,7 @@ namespace concepts
   /* The `basic_outcome` concept.
   \requires That `U` matches a `basic_outcome`.
   */
-  template <class U> static constexpr bool basic_outcome = detail::basic_outcome<U>;
+  template <class U> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool basic_outcome = detail::basic_outcome<U>;
 #endif
 }  // namespace concepts
 
@@ -243,13 +289,19 @@ class OUTCOME_NODISCARD basic_outcome
       public detail::basic_result_final<R, S, NoValuePolicy>
 #else
     : public detail::select_basic_outcome_failure_observers<
-      detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>
+      detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>,
+      protected detail::basic_outcome_exception_storage<P, !std::is_void<typename detail::exclusive_exception_type_of<NoValuePolicy>::type>::value>
 #endif
 {
   static_assert(trait::type_can_be_used_in_basic_result<P>, "The exception_type cannot be used");
   static_assert(std::is_void<P>::value || std::is_default_constructible<P>::value, "exception_type must be void or default constructible");
   using base = detail::select_basic_outcome_failure_observers<
   detail::basic_outcome_exception_observers<detail::basic_result_final<R, S, NoValuePolicy>, R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>;
+  // True if the exception shares the union with the value and the error, see policy::exclusive_exception
+  static constexpr bool _exclusive_exception = !std::is_void<typename detail::exclusive_exception_type_of<NoValuePolicy>::type>::value;
+  static_assert(!_exclusive_exception || std::is_same<typename detail::exclusive_exception_type_of<NoValuePolicy>::type, P>::value,
+                "policy::exclusive_exception must name the exception_type of the basic_outcome");
+  using _exception_storage = detail::basic_outcome_exception_storage<P, _exclusive_exception>;
   friend struct policy::base;
   template <class T, class U, class V, class W>  //
   friend class basic_outcome;
@@ -420,7 +472,16 @@ public:
                                                        disable_in_place_exception_type, exception_type>;
 
 protected:
-  detail::devoid<exception_type> _ptr;
+  constexpr detail::devoid<exception_type> &_exception_ref() & noexcept { return this->_exception_storage::_get(this->_state); }
+  constexpr const detail::devoid<exception_type> &_exception_ref() const & noexcept { return this->_exception_storage::_get(this->_state); }
+  constexpr detail::devoid<exception_type> &&_exception_ref() && noexcept
+  {
+    return static_cast<detail::devoid<exception_type> &&>(this->_exception_storage::_get(this->_state));
+  }
+  constexpr const detail::devoid<exception_type> &&_exception_ref() const && noexcept
+  {
+    return static_cast<const detail::devoid<exception_type> &&>(this->_exception_storage::_get(this->_state));
+  }
 
 public:
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -448,7 +509,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(T &&t, value_converting_constructor_tag /*unused*/ = value_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<value_type, T>)  // NOLINT
       : base{in_place_type<typename base::_value_type>, static_cast<T &&>(t)}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(t));
   }
@@ -460,7 +521,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(T &&t, error_converting_constructor_tag /*unused*/ = error_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, static_cast<T &&>(t)}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(t));
   }
@@ -484,7 +545,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(T &&t, exception_converting_constructor_tag /*unused*/ = exception_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<exception_type, T>)  // NOLINT
       : base()
-      , _ptr(static_cast<T &&>(t))
+      , _exception_storage(this->_state, static_cast<T &&>(t))
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(t));
@@ -493,11 +554,11 @@ SIGNATURE NOT RECOGNISED
 SIGNATURE NOT RECOGNISED
 */
   OUTCOME_TEMPLATE(class T, class U)
-  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_error_exception_converting_constructor<T, U>))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_error_exception_converting_constructor<T, U> && !_exclusive_exception))
   constexpr basic_outcome(T &&a, U &&b, error_exception_converting_constructor_tag /*unused*/ = error_exception_converting_constructor_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T> && detail::is_nothrow_constructible<exception_type, U>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, static_cast<T &&>(a)}
-      , _ptr(static_cast<U &&>(b))
+      , _exception_storage(this->_state, static_cast<U &&>(b))
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_construction(this, static_cast<T &&>(a), static_cast<U &&>(b));
@@ -519,14 +580,16 @@ SIGNATURE NOT RECOGNISED
 SIGNATURE NOT RECOGNISED
 */
   OUTCOME_TEMPLATE(class T, class U, class V, class W)
-  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_compatible_conversion<T, U, V, W>))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_compatible_conversion<T, U, V, W> &&
+                                  (_exclusive_exception || std::is_void<typename detail::exclusive_exception_type_of<W>::type>::value)))
   constexpr explicit basic_outcome(
   const basic_outcome<T, U, V, W> &o,
   explicit_compatible_copy_conversion_tag /*unused*/ = explicit_compatible_copy_conversion_tag()) noexcept(detail::is_nothrow_constructible<value_type, T> &&
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type, V>)
       : base{typename base::compatible_conversion_tag(), o}
-      , _ptr(o._ptr)
+      , _exception_storage(this->_state, detail::basic_outcome_exception_if_tag(),
+                           !basic_outcome<T, U, V, W>::_exclusive_exception && o._state._status.have_exception(), o._exception_ref())
   {
     no_value_policy_type::on_outcome_copy_construction(this, o);
   }
@@ -534,14 +597,17 @@ SIGNATURE NOT RECOGNISED
 SIGNATURE NOT RECOGNISED
 */
   OUTCOME_TEMPLATE(class T, class U, class V, class W)
-  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_compatible_conversion<T, U, V, W>))
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_compatible_conversion<T, U, V, W> &&
+                                  (_exclusive_exception || std::is_void<typename detail::exclusive_exception_type_of<W>::type>::value)))
   constexpr explicit basic_outcome(
   basic_outcome<T, U, V, W> &&o,
   explicit_compatible_move_conversion_tag /*unused*/ = explicit_compatible_move_conversion_tag()) noexcept(detail::is_nothrow_constructible<value_type, T> &&
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type, V>)
       : base{typename base::compatible_conversion_tag(), static_cast<basic_outcome<T, U, V, W> &&>(o)}
-      , _ptr(static_cast<typename basic_outcome<T, U, V, W>::exception_type &&>(o._ptr))
+      , _exception_storage(this->_state, detail::basic_outcome_exception_if_tag(),
+                           !basic_outcome<T, U, V, W>::_exclusive_exception && o._state._status.have_exception(),
+                           static_cast<typename basic_outcome<T, U, V, W>::exception_type &&>(o._exception_ref()))
   {
     no_value_policy_type::on_outcome_move_construction(this, static_cast<basic_outcome<T, U, V, W> &&>(o));
   }
@@ -556,7 +622,7 @@ SIGNATURE NOT RECOGNISED
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type>)
       : base{typename base::compatible_conversion_tag(), o}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_copy_construction(this, o);
   }
@@ -571,7 +637,7 @@ SIGNATURE NOT RECOGNISED
                                                                                                            detail::is_nothrow_constructible<error_type, U> &&
                                                                                                            detail::is_nothrow_constructible<exception_type>)
       : base{typename base::compatible_conversion_tag(), static_cast<basic_result<T, U, V> &&>(o)}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
   }
@@ -586,7 +652,7 @@ SIGNATURE NOT RECOGNISED
                                                                                                        noexcept(make_error_code(std::declval<U>())) &&
                                                                                                        detail::is_nothrow_constructible<exception_type>)
       : base{typename base::make_error_code_compatible_conversion_tag(), o}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_copy_construction(this, o);
   }
@@ -601,7 +667,7 @@ SIGNATURE NOT RECOGNISED
                                                                                                        noexcept(make_error_code(std::declval<U>())) &&
                                                                                                        detail::is_nothrow_constructible<exception_type>)
       : base{typename base::make_error_code_compatible_conversion_tag(), static_cast<basic_result<T, U, V> &&>(o)}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_move_construction(this, static_cast<basic_result<T, U, V> &&>(o));
   }
@@ -614,7 +680,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<Args...>))
   constexpr explicit basic_outcome(in_place_type_t<value_type_if_enabled> _, Args &&...args) noexcept(detail::is_nothrow_constructible<value_type, Args...>)
       : base{_, static_cast<Args &&>(args)...}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<value_type>, static_cast<Args &&>(args)...);
   }
@@ -626,7 +692,7 @@ SIGNATURE NOT RECOGNISED
   constexpr explicit basic_outcome(in_place_type_t<value_type_if_enabled> _, std::initializer_list<U> il,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<value_type, std::initializer_list<U>, Args...>)
       : base{_, il, static_cast<Args &&>(args)...}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<value_type>, il, static_cast<Args &&>(args)...);
   }
@@ -637,7 +703,7 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<Args...>))
   constexpr explicit basic_outcome(in_place_type_t<error_type_if_enabled> _, Args &&...args) noexcept(detail::is_nothrow_constructible<error_type, Args...>)
       : base{_, static_cast<Args &&>(args)...}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<error_type>, static_cast<Args &&>(args)...);
   }
@@ -649,7 +715,7 @@ SIGNATURE NOT RECOGNISED
   constexpr explicit basic_outcome(in_place_type_t<error_type_if_enabled> _, std::initializer_list<U> il,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<error_type, std::initializer_list<U>, Args...>)
       : base{_, il, static_cast<Args &&>(args)...}
-      , _ptr()
+      , _exception_storage()
   {
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<error_type>, il, static_cast<Args &&>(args)...);
   }
@@ -661,7 +727,7 @@ SIGNATURE NOT RECOGNISED
   constexpr explicit basic_outcome(in_place_type_t<exception_type_if_enabled> /*unused*/,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<exception_type, Args...>)
       : base()
-      , _ptr(static_cast<Args &&>(args)...)
+      , _exception_storage(this->_state, static_cast<Args &&>(args)...)
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<exception_type>, static_cast<Args &&>(args)...);
@@ -674,7 +740,7 @@ SIGNATURE NOT RECOGNISED
   constexpr explicit basic_outcome(in_place_type_t<exception_type_if_enabled> /*unused*/, std::initializer_list<U> il,
                                    Args &&...args) noexcept(detail::is_nothrow_constructible<exception_type, std::initializer_list<U>, Args...>)
       : base()
-      , _ptr(il, static_cast<Args &&>(args)...)
+      , _exception_storage(this->_state, il, static_cast<Args &&>(args)...)
   {
     this->_state._status.set_have_exception(true);
     no_value_policy_type::on_outcome_in_place_construction(this, in_place_type<exception_type>, il, static_cast<Args &&>(args)...);
@@ -732,7 +798,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(const failure_type<T> &o,
                           error_failure_tag /*unused*/ = error_failure_tag()) noexcept(detail::is_nothrow_constructible<error_type, T>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(o)}
-      , _ptr()
+      , _exception_storage()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -745,7 +811,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(const failure_type<T> &o,
                           exception_failure_tag /*unused*/ = exception_failure_tag()) noexcept(detail::is_nothrow_constructible<exception_type, T>)  // NOLINT
       : base()
-      , _ptr(detail::extract_exception_from_failure<exception_type>(o))
+      , _exception_storage(this->_state, detail::extract_exception_from_failure<exception_type>(o))
   {
     this->_state._status.set_have_exception(true);
     hooks::set_spare_storage(this, o.spare_storage());
@@ -760,7 +826,7 @@ SIGNATURE NOT RECOGNISED
                           explicit_make_error_code_compatible_copy_conversion_tag /*unused*/ =
                           explicit_make_error_code_compatible_copy_conversion_tag()) noexcept(noexcept(make_error_code(std::declval<T>())))  // NOLINT
       : base{in_place_type<typename base::_error_type>, make_error_code(detail::extract_error_from_failure<error_type>(o))}
-      , _ptr()
+      , _exception_storage()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -773,7 +839,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(const failure_type<T, U> &o, explicit_compatible_copy_conversion_tag /*unused*/ = explicit_compatible_copy_conversion_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T> && detail::is_nothrow_constructible<exception_type, U>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(o)}
-      , _ptr(detail::extract_exception_from_failure<exception_type>(o))
+      , _exception_storage(this->_state, detail::basic_outcome_exception_if_tag(), o.has_exception(), detail::extract_exception_from_failure<exception_type>(o))
   {
     if(!o.has_error())
     {
@@ -795,7 +861,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(failure_type<T> &&o,
                           error_failure_tag /*unused*/ = error_failure_tag()) noexcept(detail::is_nothrow_constructible<error_type, T>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(static_cast<failure_type<T> &&>(o))}
-      , _ptr()
+      , _exception_storage()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -808,7 +874,7 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(failure_type<T> &&o,
                           exception_failure_tag /*unused*/ = exception_failure_tag()) noexcept(detail::is_nothrow_constructible<exception_type, T>)  // NOLINT
       : base()
-      , _ptr(detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T> &&>(o)))
+      , _exception_storage(this->_state, detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T> &&>(o)))
   {
     this->_state._status.set_have_exception(true);
     hooks::set_spare_storage(this, o.spare_storage());
@@ -823,7 +889,7 @@ SIGNATURE NOT RECOGNISED
                           explicit_make_error_code_compatible_move_conversion_tag /*unused*/ =
                           explicit_make_error_code_compatible_move_conversion_tag()) noexcept(noexcept(make_error_code(std::declval<T>())))  // NOLINT
       : base{in_place_type<typename base::_error_type>, make_error_code(detail::extract_error_from_failure<error_type>(static_cast<failure_type<T> &&>(o)))}
-      , _ptr()
+      , _exception_storage()
   {
     hooks::set_spare_storage(this, o.spare_storage());
     no_value_policy_type::on_outcome_copy_construction(this, o);
@@ -836,7 +902,8 @@ SIGNATURE NOT RECOGNISED
   constexpr basic_outcome(failure_type<T, U> &&o, explicit_compatible_move_conversion_tag /*unused*/ = explicit_compatible_move_conversion_tag()) noexcept(
   detail::is_nothrow_constructible<error_type, T> && detail::is_nothrow_constructible<exception_type, U>)  // NOLINT
       : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(static_cast<failure_type<T, U> &&>(o))}
-      , _ptr(detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T, U> &&>(o)))
+      , _exception_storage(this->_state, detail::basic_outcome_exception_if_tag(), o.has_exception(),
+                           detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T, U> &&>(o)))
   {
     if(!o.has_error())
     {
@@ -874,7 +941,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error == o._state._error && this->_ptr == o._ptr;
+      return this->_state._error == o._state._error && this->_exception_ref() == o._exception_ref();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -882,7 +949,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr == o._ptr;
+      return this->_exception_ref() == o._exception_ref();
     }
     return false;
   }
@@ -898,7 +965,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error == o.error() && this->_ptr == o.exception();
+      return this->_state._error == o.error() && this->_exception_ref() == o.exception();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -906,7 +973,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr == o.exception();
+      return this->_exception_ref() == o.exception();
     }
     return false;
   }
@@ -929,7 +996,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error != o._state._error || this->_ptr != o._ptr;
+      return this->_state._error != o._state._error || this->_exception_ref() != o._exception_ref();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -937,7 +1004,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr != o._ptr;
+      return this->_exception_ref() != o._exception_ref();
     }
     return true;
   }
@@ -953,7 +1020,7 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_state._error != o.error() || this->_ptr != o.exception();
+      return this->_state._error != o.error() || this->_exception_ref() != o.exception();
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
@@ -961,7 +1028,7 @@ SIGNATURE NOT RECOGNISED
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_ptr != o.exception();
+      return this->_exception_ref() != o.exception();
     }
     return true;
   }
@@ -969,10 +1036,30 @@ SIGNATURE NOT RECOGNISED
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-  constexpr void swap(basic_outcome &o) noexcept((std::is_void<value_type>::value || detail::is_nothrow_swappable<value_type>::value)     //
-                                                 && (std::is_void<error_type>::value || detail::is_nothrow_swappable<error_type>::value)  //
-                                                 && (std::is_void<exception_type>::value || detail::is_nothrow_swappable<exception_type>::value))
+  constexpr void swap(basic_outcome &o) noexcept(((std::is_void<value_type>::value || detail::is_nothrow_swappable<value_type>::value)     //
+                                                  && (std::is_void<error_type>::value || detail::is_nothrow_swappable<error_type>::value)  //
+                                                  && (std::is_void<exception_type>::value || detail::is_nothrow_swappable<exception_type>::value))
+                                                 || trait::is_trivially_relocatable<basic_outcome>::value)
   {
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4127)  // conditional expression is constant
+#endif
+    if(trait::is_trivially_relocatable<basic_outcome>::value && !detail::is_constant_evaluated())
+    {
+      // Nothing within cares where it lives, so exchange the bytes
+      detail::relocating_swap(*this, o);
+      return;
+    }
+    if(_exclusive_exception)
+    {
+      // The state holds the exception too
+      this->_state.swap(o._state);
+      return;
+    }
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
 #ifdef __cpp_exceptions
     constexpr bool value_throws = !std::is_void<value_type>::value && !detail::is_nothrow_swappable<value_type>::value;
     constexpr bool error_throws = !std::is_void<error_type>::value && !detail::is_nothrow_swappable<error_type>::value;
@@ -986,7 +1073,7 @@ SIGNATURE NOT RECOGNISED
       // Simples
       this->_state.swap(o._state);
       using std::swap;
-      swap(this->_ptr, o._ptr);
+      swap(this->_exception_ref(), o._exception_ref());
       return;
     }
     struct some_type
@@ -1005,10 +1092,10 @@ SIGNATURE NOT RECOGNISED
         }
         if(this->exceptioned)
         {
-          // The value + error swap threw an exception. Try to swap back _ptr
+          // The value + error swap threw an exception. Try to swap back the exception
           try
           {
-            strong_swap(this->all_good, this->a._ptr, this->b._ptr);
+            strong_swap(this->all_good, this->a._exception_ref(), this->b._exception_ref());
           }
           catch(...)
           {
@@ -1037,7 +1124,7 @@ SIGNATURE NOT RECOGNISED
         }
       }
     } some_type_value{*this, o};
-    strong_swap(some_type_value.all_good, this->_ptr, o._ptr);
+    strong_swap(some_type_value.all_good, this->_exception_ref(), o._exception_ref());
     some_type_value.exceptioned = true;
     this->_state.swap(o._state);
     some_type_value.exceptioned = false;
@@ -1047,7 +1134,7 @@ SIGNATURE NOT RECOGNISED
 #else
     this->_state.swap(o._state);
     using std::swap;
-    swap(this->_ptr, o._ptr);
+    swap(this->_exception_ref(), o._exception_ref());
 #endif
   }
 
@@ -1072,17 +1159,23 @@ SIGNATURE NOT RECOGNISED
 */
   failure_type<error_type, exception_type> as_failure() &&
   {
-    this->_state._status.set_have_moved_from(true);
+    // Mark moved-from only after the move, so moved-from checks do not trap on the move itself
     if(this->has_error() && this->has_exception())
     {
-      return failure_type<error_type, exception_type>(static_cast<S &&>(this->assume_error()), static_cast<P &&>(this->assume_exception()),
-                                                      hooks::spare_storage(this));
+      failure_type<error_type, exception_type> ret(static_cast<S &&>(this->assume_error()), static_cast<P &&>(this->assume_exception()),
+                                                   hooks::spare_storage(this));
+      this->_state._status.set_have_moved_from(true);
+      return ret;
     }
     if(this->has_exception())
     {
-      return failure_type<error_type, exception_type>(in_place_type<exception_type>, static_cast<P &&>(this->assume_exception()), hooks::spare_storage(this));
+      failure_type<error_type, exception_type> ret(in_place_type<exception_type>, static_cast<P &&>(this->assume_exception()), hooks::spare_storage(this));
+      this->_state._status.set_have_moved_from(true);
+      return ret;
     }
-    return failure_type<error_type, exception_type>(in_place_type<error_type>, static_cast<S &&>(this->assume_error()), hooks::spare_storage(this));
+    failure_type<error_type, exception_type> ret(in_place_type<error_type>, static_cast<S &&>(this->assume_error()), hooks::spare_storage(this));
+    this->_state._status.set_have_moved_from(true);
+    return ret;
   }
 
 #ifdef __APPLE__
@@ -1124,6 +1217,16 @@ template <class R, class S, class P, class N> inline void swap(basic_outcome<R,
   a.swap(b);
 }
 
+namespace trait
+{
+  // A basic_outcome may be relocated by copying its bytes if its value, error and exception may
+  template <class R, class S, class P, class N> struct is_trivially_relocatable<basic_outcome<R, S, P, N>>
+  {
+    static constexpr bool value = is_trivially_relocatable<detail::devoid<R>>::value && is_trivially_relocatable<detail::devoid<S>>::value &&
+                                  is_trivially_relocatable<detail::devoid<P>>::value;
+  };
+}  // namespace trait
+
 namespace hooks
 {
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -1132,7 +1235,7 @@ SIGNATURE NOT RECOGNISED
   template <class R, class S, class P, class NoValuePolicy, class U>
   constexpr inline void override_outcome_exception(basic_outcome<R, S, P, NoValuePolicy> *o, U &&v) noexcept
   {
-    o->_ptr = static_cast<U &&>(v);  // NOLINT
+    o->_exception_storage::_assign(o->_state, static_cast<U &&>(v));  // NOLINT
     o->_state._status.set_have_exception(true);
   }
 }  // namespace hooks
@@ -180,7 +180,7 @@ template <class T> using is_basic_result = detail::is_basic_result<std::decay_t<
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
+template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
 
 namespace concepts
 {
@@ -208,14 +208,14 @@ namespace concepts
     inline OUTCOME_V2_NAMESPACE::basic_result<R, S, NVP> match_basic_result(OUTCOME_V2_NAMESPACE::basic_result<R, S, NVP> &&, T &&);
 
     template <class U>
-    static constexpr bool basic_result = OUTCOME_V2_NAMESPACE::is_basic_result<U>::value ||
+    OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool basic_result = OUTCOME_V2_NAMESPACE::is_basic_result<U>::value ||
                                          !std::is_same<no_match, decltype(match_basic_result(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>(),
                                                                                              std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
   }  // namespace detail
   /* The `basic_result` concept.
   \requires That `U` matches a `basic_result`.
   */
-  template <class U> static constexpr bool basic_result = detail::basic_result<U>;
+  template <class U> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool basic_result = detail::basic_result<U>;
 #endif
 }  // namespace concepts
 
@@ -247,7 +247,7 @@ type definition template <class R, class S, class NoValuePolicy> basic_result. P
 template <class R, class S, class NoValuePolicy>  //
 class OUTCOME_NODISCARD basic_result : public detail::basic_result_final<R, S, NoValuePolicy>
 {
-  static_assert(trait::type_can_be_used_in_basic_result<R>, "The type R cannot be used in a basic_result");
+  static_assert(trait::type_can_be_used_in_basic_result<typename detail::value_storage_type_of<R>::type>, "The type R cannot be used in a basic_result");
   static_assert(trait::type_can_be_used_in_basic_result<S>, "The type S cannot be used in a basic_result");
 
   using base = detail::basic_result_final<R, S, NoValuePolicy>;
@@ -704,14 +704,79 @@ SIGNATURE NOT RECOGNISED
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-  constexpr void swap(basic_result &o) noexcept((std::is_void<value_type>::value || detail::is_nothrow_swappable<value_type>::value)  //
-                                                && (std::is_void<error_type>::value || detail::is_nothrow_swappable<error_type>::value))
+  constexpr void swap(basic_result &o) noexcept(((std::is_void<value_type>::value || detail::is_nothrow_swappable<value_type>::value)  //
+                                                 && (std::is_void<error_type>::value || detail::is_nothrow_swappable<error_type>::value))
+                                                || trait::is_trivially_relocatable<basic_result>::value)
   {
     this->_state.swap(o._state);
   }
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<Args...>))
+  constexpr typename base::_value_lref emplace_value(Args &&...args)
+  {
+    detail::storage_emplace_value(this->_state, static_cast<Args &&>(args)...);
+    no_value_policy_type::on_result_in_place_construction(this, in_place_type<value_type>, static_cast<Args &&>(args)...);
+    return static_cast<typename base::_value_lref>(detail::value_of(this->_state));
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U, class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<std::initializer_list<U>, Args...>))
+  constexpr typename base::_value_lref emplace_value(std::initializer_list<U> il, Args &&...args)
+  {
+    detail::storage_emplace_value(this->_state, il, static_cast<Args &&>(args)...);
+    no_value_policy_type::on_result_in_place_construction(this, in_place_type<value_type>, il, static_cast<Args &&>(args)...);
+    return static_cast<typename base::_value_lref>(detail::value_of(this->_state));
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<Args...>))
+  constexpr std::add_lvalue_reference_t<error_type> emplace_error(Args &&...args)
+  {
+    detail::storage_emplace_error(this->_state, static_cast<Args &&>(args)...);
+    no_value_policy_type::on_result_in_place_construction(this, in_place_type<error_type>, static_cast<Args &&>(args)...);
+    return static_cast<std::add_lvalue_reference_t<error_type>>(this->_state._error);
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class U, class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<std::initializer_list<U>, Args...>))
+  constexpr std::add_lvalue_reference_t<error_type> emplace_error(std::initializer_list<U> il, Args &&...args)
+  {
+    detail::storage_emplace_error(this->_state, il, static_cast<Args &&>(args)...);
+    no_value_policy_type::on_result_in_place_construction(this, in_place_type<error_type>, il, static_cast<Args &&>(args)...);
+    return static_cast<std::add_lvalue_reference_t<error_type>>(this->_state._error);
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class T = value_type)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_void<T>::value || std::is_default_constructible<T>::value))
+  constexpr typename base::_value_lref reset_to_value()
+  {
+    // A value already held is kept as it is, along with whatever it has allocated
+    if(detail::storage_holds_value(this->_state))
+    {
+      this->_state._status.set_have_moved_from(false);
+    }
+    else
+    {
+      detail::storage_construct_value(this->_state);
+    }
+    no_value_policy_type::on_result_in_place_construction(this, in_place_type<value_type>);
+    return static_cast<typename base::_value_lref>(detail::value_of(this->_state));
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
 */
   auto as_failure() const & { return failure(this->assume_error(), hooks::spare_storage(this)); }
   /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -719,8 +784,10 @@ SIGNATURE NOT RECOGNISED
 */
   auto as_failure() &&
   {
+    // Mark moved-from only after the move, so moved-from checks do not trap on the move itself
+    auto ret = failure(static_cast<basic_result &&>(*this).assume_error(), hooks::spare_storage(this));
     this->_state._status.set_have_moved_from(true);
-    return failure(static_cast<basic_result &&>(*this).assume_error(), hooks::spare_storage(this));
+    return ret;
   }
 
 #ifdef __APPLE__
@@ -736,6 +803,15 @@ template <class R, class S, class P> inline void swap(basic_result<R, S, P> &a,
   a.swap(b);
 }
 
+namespace trait
+{
+  // A basic_result may be relocated by copying its bytes if its value and error may
+  template <class R, class S, class P> struct is_trivially_relocatable<basic_result<R, S, P>>
+  {
+    static constexpr bool value = is_trivially_relocatable<detail::devoid<R>>::value && is_trivially_relocatable<detail::devoid<S>>::value;
+  };
+}  // namespace trait
+
 #if !defined(NDEBUG)
 // Check is trivial in all ways except default constructibility
 // static_assert(std::is_trivial<basic_result<int, long, policy::all_narrow>>::value, "result<int> is not trivial!");
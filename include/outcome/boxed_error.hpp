@@ -0,0 +1,281 @@
+/* An error which is allocated only on failure, so large errors do not inflate results
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_BOXED_ERROR_HPP
+#define OUTCOME_BOXED_ERROR_HPP
+
+#include "config.hpp"
+#include "trait.hpp"
+
+#include <cstddef>
+#include <new>
+#include <system_error>
+
+//! The maximum number of freed boxes of each size which each thread keeps for reuse
+#ifndef OUTCOME_BOXED_ERROR_POOL_BLOCKS
+#define OUTCOME_BOXED_ERROR_POOL_BLOCKS 16
+#endif
+
+#ifndef OUTCOME_BOXED_ERROR_COLD
+#if defined(__GNUC__) || defined(__clang__)
+#define OUTCOME_BOXED_ERROR_COLD __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define OUTCOME_BOXED_ERROR_COLD __declspec(noinline)
+#else
+#define OUTCOME_BOXED_ERROR_COLD
+#endif
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  /* Each thread keeps a short free list of the boxes it has freed, so code which fails repeatedly does not
+  go to the allocator each time. Boxes of errors of the same size share a pool, and a box freed by a thread
+  other than the one which allocated it goes onto the freeing thread's list. A box freed during thread exit
+  after the thread's pool has been destroyed, say by another thread_local, goes straight to the allocator.
+  */
+  template <size_t Size> class boxed_error_pool
+  {
+    struct block
+    {
+      block *next;
+    };
+    static constexpr size_t _block_size = (Size < sizeof(block)) ? sizeof(block) : Size;
+
+    block *_free{nullptr};
+    size_t _count{0};
+
+    // Trivially destructible, so still readable once the pool has been destroyed
+    static bool &_destroyed() noexcept
+    {
+      static thread_local bool v;
+      return v;
+    }
+    static boxed_error_pool *_instance() noexcept
+    {
+      if(_destroyed())
+      {
+        return nullptr;
+      }
+      static thread_local boxed_error_pool v;
+      return &v;
+    }
+
+  public:
+    boxed_error_pool() = default;
+    boxed_error_pool(const boxed_error_pool &) = delete;
+    boxed_error_pool(boxed_error_pool &&) = delete;
+    boxed_error_pool &operator=(const boxed_error_pool &) = delete;
+    boxed_error_pool &operator=(boxed_error_pool &&) = delete;
+    ~boxed_error_pool()
+    {
+      while(_free != nullptr)
+      {
+        block *b = _free;
+        _free = b->next;
+        ::operator delete(b);
+      }
+      _count = 0;
+      _destroyed() = true;
+    }
+
+    static void *allocate()
+    {
+      boxed_error_pool *pool = _instance();
+      if(pool != nullptr && pool->_free != nullptr)
+      {
+        block *b = pool->_free;
+        pool->_free = b->next;
+        --pool->_count;
+        return b;
+      }
+      return ::operator new(_block_size);
+    }
+    static void deallocate(void *p) noexcept
+    {
+      boxed_error_pool *pool = _instance();
+      if(pool != nullptr && pool->_count < OUTCOME_BOXED_ERROR_POOL_BLOCKS)
+      {
+        pool->_free = new(p) block{pool->_free};
+        ++pool->_count;
+        return;
+      }
+      ::operator delete(p);
+    }
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class E> boxed_error. Potential doc page: `boxed_error<E>`
+*/
+template <class E> class boxed_error
+{
+  static_assert(alignof(E) <= alignof(std::max_align_t), "boxed_error<E> does not support over aligned E");
+
+  using _pool = detail::boxed_error_pool<sizeof(E)>;
+
+  // A successful result never constructs one, so everything which allocates is kept out of line
+  E *_ptr{nullptr};
+
+  template <class... Args> OUTCOME_BOXED_ERROR_COLD static E *_make(Args &&...args)
+  {
+    struct deallocate_on_throw
+    {
+      void *p;
+      ~deallocate_on_throw()
+      {
+        if(p != nullptr)
+        {
+          _pool::deallocate(p);
+        }
+      }
+    } g{_pool::allocate()};
+    E *ret = new(g.p) E(static_cast<Args &&>(args)...);
+    g.p = nullptr;
+    return ret;
+  }
+  OUTCOME_BOXED_ERROR_COLD static void _destroy(E *p) noexcept
+  {
+    p->~E();
+    _pool::deallocate(p);
+  }
+
+public:
+  //! The type of error boxed.
+  using element_type = E;
+
+  //! Default construction holds no error, as does a moved from box.
+  constexpr boxed_error() noexcept = default;
+  //! Implicit construction from an error, which allocates the box.
+  boxed_error(const E &e)  // NOLINT
+      : _ptr(_make(e))
+  {
+  }
+  //! Implicit construction from an error, which allocates the box.
+  boxed_error(E &&e)  // NOLINT
+      : _ptr(_make(static_cast<E &&>(e)))
+  {
+  }
+  //! In place construction of the error, which allocates the box.
+  template <class... Args>
+  explicit boxed_error(in_place_type_t<E> /*unused*/, Args &&...args)
+      : _ptr(_make(static_cast<Args &&>(args)...))
+  {
+  }
+  //! Copies the error into a new box.
+  boxed_error(const boxed_error &o)
+      : _ptr((o._ptr != nullptr) ? _make(*o._ptr) : nullptr)
+  {
+  }
+  //! Takes the box, leaving the source empty.
+  constexpr boxed_error(boxed_error &&o) noexcept
+      : _ptr(o._ptr)
+  {
+    o._ptr = nullptr;
+  }
+  boxed_error &operator=(const boxed_error &o)
+  {
+    if(this != &o)
+    {
+      boxed_error temp(o);
+      *this = static_cast<boxed_error &&>(temp);
+    }
+    return *this;
+  }
+  boxed_error &operator=(boxed_error &&o) noexcept
+  {
+    if(this != &o)
+    {
+      reset();
+      _ptr = o._ptr;
+      o._ptr = nullptr;
+    }
+    return *this;
+  }
+  ~boxed_error() { reset(); }
+
+  //! Frees the box, if any.
+  void reset() noexcept
+  {
+    if(_ptr != nullptr)
+    {
+      _destroy(_ptr);
+      _ptr = nullptr;
+    }
+  }
+
+  //! True if there is a box.
+  constexpr explicit operator bool() const noexcept { return _ptr != nullptr; }
+  //! The error, or null if there is no box.
+  constexpr E *get() noexcept { return _ptr; }
+  constexpr const E *get() const noexcept { return _ptr; }
+  //! The error, which must have been boxed.
+  constexpr E &operator*() noexcept { return *_ptr; }
+  constexpr const E &operator*() const noexcept { return *_ptr; }
+  constexpr E *operator->() noexcept { return _ptr; }
+  constexpr const E *operator->() const noexcept { return _ptr; }
+  //! Implicit conversion to the error, which must have been boxed, so `error()` can be used as if it were the error.
+  constexpr operator E &() noexcept { return *_ptr; }              // NOLINT
+  constexpr operator const E &() const noexcept { return *_ptr; }  // NOLINT
+
+  //! Compares the errors, an empty box comparing equal only to another empty box.
+  friend bool operator==(const boxed_error &a, const boxed_error &b) noexcept(noexcept(std::declval<const E &>() == std::declval<const E &>()))
+  {
+    return (a._ptr == nullptr || b._ptr == nullptr) ? (a._ptr == b._ptr) : static_cast<bool>(*a._ptr == *b._ptr);
+  }
+  friend bool operator!=(const boxed_error &a, const boxed_error &b) noexcept(noexcept(std::declval<const E &>() == std::declval<const E &>()))
+  {
+    return !(a == b);
+  }
+};
+
+//! ADL discovered, forwards `make_error_code()` of the boxed error, so the default policies are those of the error.
+OUTCOME_TEMPLATE(class E)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(make_error_code(std::declval<const E &>())))
+inline auto make_error_code(const boxed_error<E> &e) noexcept(noexcept(make_error_code(*e))) -> decltype(make_error_code(*e))
+{
+  return make_error_code(*e);
+}
+
+//! ADL discovered, forwards to that of the boxed error for the `error_code_throw_as_system_error` policy.
+OUTCOME_TEMPLATE(class E)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(outcome_throw_as_system_error_with_payload(std::declval<const E &>())))
+inline void outcome_throw_as_system_error_with_payload(const boxed_error<E> &e)
+{
+  outcome_throw_as_system_error_with_payload(*e);
+}
+
+namespace trait
+{
+  // boxed_error is an error type
+  template <class E> struct is_error_type<boxed_error<E>>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace trait
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,232 @@
+/* A std::error_code which fits, along with a 64 bit value, into two registers
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COMPACT_ERROR_CODE_HPP
+#define OUTCOME_COMPACT_ERROR_CODE_HPP
+
+#include "detail/trait_std_error_code.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <system_error>
+
+//! The maximum number of error categories which can be registered, including the system and generic categories.
+//! Registering any more is fatal.
+#ifndef OUTCOME_COMPACT_ERROR_CODE_CATEGORIES
+#define OUTCOME_COMPACT_ERROR_CODE_CATEGORIES 64
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // Losing the category would silently change what a code means, so running out of room is fatal
+  inline void compact_error_code_registry_full(const std::error_category &category) noexcept
+  {
+    fprintf(stderr, "FATAL: Outcome compact_error_code could not register category %s, define OUTCOME_COMPACT_ERROR_CODE_CATEGORIES above %d\n",  // NOLINT
+            category.name(), OUTCOME_COMPACT_ERROR_CODE_CATEGORIES);
+    abort();
+  }
+
+  // Categories are only ever appended. Each is written before the count is published, so lookups need no lock.
+  class compact_error_code_registry
+  {
+    std::mutex _lock;
+    std::atomic<uint16_t> _count{2};
+    // The system category is index zero, so that a default constructed code is a default constructed std::error_code
+    const std::error_category *_categories[OUTCOME_COMPACT_ERROR_CODE_CATEGORIES] = {&std::system_category(), &std::generic_category()};
+
+    uint16_t _find(const std::error_category &category, uint16_t count) const noexcept
+    {
+      for(uint16_t n = 0; n < count; n++)
+      {
+        if(*_categories[n] == category)
+        {
+          return n;
+        }
+      }
+      return not_found;
+    }
+
+  public:
+    static constexpr uint16_t not_found = UINT16_MAX;
+
+    compact_error_code_registry() = default;
+    compact_error_code_registry(const compact_error_code_registry &) = delete;
+    compact_error_code_registry(compact_error_code_registry &&) = delete;
+    compact_error_code_registry &operator=(const compact_error_code_registry &) = delete;
+    compact_error_code_registry &operator=(compact_error_code_registry &&) = delete;
+    ~compact_error_code_registry() = default;
+
+    const std::error_category &category(uint16_t index) const noexcept
+    {
+      return *_categories[index];
+    }
+
+    // Registers the category if it has not been seen before
+    uint16_t index(const std::error_category &category) noexcept
+    {
+      const uint16_t ret = _find(category, _count.load(std::memory_order_acquire));
+      if(ret != not_found)
+      {
+        return ret;
+      }
+      std::lock_guard<std::mutex> g(_lock);
+      const uint16_t n = _count.load(std::memory_order_relaxed);
+      const uint16_t found = _find(category, n);
+      if(found != not_found)
+      {
+        return found;
+      }
+      if(n == OUTCOME_COMPACT_ERROR_CODE_CATEGORIES)
+      {
+        compact_error_code_registry_full(category);
+      }
+      _categories[n] = &category;
+      _count.store(n + 1, std::memory_order_release);
+      return n;
+    }
+  };
+  static_assert(OUTCOME_COMPACT_ERROR_CODE_CATEGORIES >= 2 && OUTCOME_COMPACT_ERROR_CODE_CATEGORIES < compact_error_code_registry::not_found,
+                "OUTCOME_COMPACT_ERROR_CODE_CATEGORIES is out of range");
+
+  inline compact_error_code_registry &compact_error_code_registry_instance() noexcept
+  {
+    static compact_error_code_registry v;
+    return v;
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  compact_error_code. Potential doc page: `compact_error_code`
+*/
+class compact_error_code
+{
+  // A 32 bit value and a 16 bit index into the registered categories, so `basic_result<int64_t, compact_error_code>`
+  // is two registers, and trivially copyable, where `basic_result<int64_t, std::error_code>` is four
+  int32_t _value{0};
+  uint16_t _category{0};
+
+  static constexpr uint16_t _system = 0;
+
+public:
+  //! Value initialisation is a default constructed `std::error_code`, value zero in the system category.
+  constexpr compact_error_code() noexcept = default;
+  //! Constructs from a value and a category, registering the category if it has not been seen before.
+  compact_error_code(int value, const std::error_category &category) noexcept
+      : _value(value)
+      , _category((category == std::system_category()) ? _system : detail::compact_error_code_registry_instance().index(category))
+  {
+  }
+  //! Implicit construction from a `std::error_code`.
+  compact_error_code(const std::error_code &ec) noexcept  // NOLINT
+      : compact_error_code(ec.value(), ec.category())
+  {
+  }
+  //! Implicit construction from an error code enum, like `std::error_code`.
+  OUTCOME_TEMPLATE(class ErrorCodeEnum)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_error_code_enum<ErrorCodeEnum>::value))
+  compact_error_code(ErrorCodeEnum e) noexcept  // NOLINT
+      : compact_error_code(make_error_code(e))
+  {
+  }
+
+  //! The error's value.
+  constexpr int value() const noexcept { return _value; }
+  //! The error's category.
+  const std::error_category &category() const noexcept
+  {
+    return (_category == _system) ? std::system_category() : detail::compact_error_code_registry_instance().category(_category);
+  }
+  //! The error's message.
+  std::string message() const { return category().message(_value); }
+  //! True if the value is not zero.
+  constexpr explicit operator bool() const noexcept { return _value != 0; }
+  //! Resets to value zero in the system category.
+  constexpr void clear() noexcept
+  {
+    _value = 0;
+    _category = _system;
+  }
+
+  //! Implicit conversion to a `std::error_code`.
+  std::error_code to_error_code() const noexcept { return {_value, category()}; }
+  operator std::error_code() const noexcept { return to_error_code(); }  // NOLINT
+
+  friend constexpr bool operator==(const compact_error_code &a, const compact_error_code &b) noexcept
+  {
+    return a._value == b._value && a._category == b._category;
+  }
+  friend constexpr bool operator!=(const compact_error_code &a, const compact_error_code &b) noexcept { return !(a == b); }
+  friend bool operator==(const compact_error_code &a, const std::error_code &b) noexcept { return a.to_error_code() == b; }
+  friend bool operator==(const std::error_code &a, const compact_error_code &b) noexcept { return a == b.to_error_code(); }
+  friend bool operator!=(const compact_error_code &a, const std::error_code &b) noexcept { return !(a == b); }
+  friend bool operator!=(const std::error_code &a, const compact_error_code &b) noexcept { return !(a == b); }
+};
+static_assert(sizeof(compact_error_code) == 8, "compact_error_code is not eight bytes");
+static_assert(std::is_trivially_copyable<compact_error_code>::value, "compact_error_code is not trivially copyable");
+
+//! ADL discovered, makes `trait::is_error_code_available<compact_error_code>` true.
+inline std::error_code make_error_code(compact_error_code ec) noexcept
+{
+  return ec.to_error_code();
+}
+
+//! ADL discovered, used by the `error_code_throw_as_system_error` policy.
+inline void outcome_throw_as_system_error_with_payload(const compact_error_code &error)
+{
+  OUTCOME_THROW_EXCEPTION(std::system_error(error.to_error_code()));  // NOLINT
+}
+
+namespace trait
+{
+  namespace detail
+  {
+    template <> struct _is_error_code_available<compact_error_code>
+    {
+      // Shortcut this for lower build impact
+      static constexpr bool value = true;
+      using type = std::error_code;
+    };
+  }  // namespace detail
+
+  // compact_error_code is an error type
+  template <> struct is_error_type<compact_error_code>
+  {
+    static constexpr bool value = true;
+  };
+  // As for std::error_code, std::is_error_condition_enum<> is the trait we want
+  template <class Enum> struct is_error_type_enum<compact_error_code, Enum>
+  {
+    static constexpr bool value = std::is_error_condition_enum<Enum>::value;
+  };
+}  // namespace trait
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,56 @@
+/* A result whose status is one byte, without spare storage
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COMPACT_RESULT_HPP
+#define OUTCOME_COMPACT_RESULT_HPP
+
+#include "std_result.hpp"
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace policy
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class Base> compact_status. Potential doc page: NOT FOUND
+*/
+  template <class Base> struct compact_status : Base
+  {
+    /* A basic_result with this policy whose value and error are both trivial keeps its status in one
+    byte rather than four, and so has no spare storage: `hooks::spare_storage()` always returns zero,
+    and `hooks::set_spare_storage()` does nothing. Otherwise its storage is as usual. It converts
+    from a basic_result with any other policy, but not the other way round.
+    */
+    static constexpr bool compact_status_storage = true;
+  };
+}  // namespace policy
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class R, class S = std::error_code, class NoValuePolicy = policy::default_policy<R, S, void>>  //
+using compact_result = basic_result<R, S, policy::compact_status<NoValuePolicy>>;
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -49,6 +49,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #ifdef DOXYGEN_IS_IN_THE_HOUSE
 #define OUTCOME_FORCEINLINE
+#define OUTCOME_OBSERVER_INLINE
 #define OUTCOME_NODISCARD [[nodiscard]]
 #define OUTCOME_TEMPLATE(...) template <__VA_ARGS__
 #define OUTCOME_TREQUIRES(...) , __VA_ARGS__ >
@@ -97,18 +98,8 @@ SIGNATURE NOT RECOGNISED
 #include "detail/revision.hpp"
 #if defined(OUTCOME_UNSTABLE_VERSION)
 #define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2, OUTCOME_PREVIOUS_COMMIT_UNIQUE))
-#ifdef _DEBUG
-#define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2d, OUTCOME_PREVIOUS_COMMIT_UNIQUE)))
-#else
-#define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2, OUTCOME_PREVIOUS_COMMIT_UNIQUE)))
-#endif
 #else
 #define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2))
-#ifdef _DEBUG
-#define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2d)))
-#else
-#define OUTCOME_V2_CXX_MODULE_NAME QUICKCPPLIB_BIND_NAMESPACE((QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2)))
-#endif
 #endif
 
 #if defined(GENERATING_OUTCOME_MODULE_INTERFACE)
@@ -192,6 +183,44 @@ OUTCOME_V2_NAMESPACE_END
 #endif
 #endif
 
+#ifndef OUTCOME_VARIABLE_TEMPLATE_LINKAGE
+#ifdef GENERATING_OUTCOME_MODULE_INTERFACE
+// Exported templates may not use entities with internal linkage
+#define OUTCOME_VARIABLE_TEMPLATE_LINKAGE inline
+#else
+#define OUTCOME_VARIABLE_TEMPLATE_LINKAGE static
+#endif
+#endif
+
+#ifndef OUTCOME_USE_TYPE_TRAIT_BUILTINS
+#if defined(__has_builtin)
+#if __has_builtin(__is_constructible) && __has_builtin(__is_trivially_constructible) && __has_builtin(__is_trivially_copyable) &&                              \
+__has_builtin(__is_assignable) && __has_builtin(__is_trivially_assignable)
+//! Defined to be `1` when the compiler has the type trait builtins used to implement the internal traits. Usually automatic, can be overriden.
+#define OUTCOME_USE_TYPE_TRAIT_BUILTINS 1
+#endif
+#elif defined(_MSC_VER) && !defined(__clang__)
+#define OUTCOME_USE_TYPE_TRAIT_BUILTINS 1
+#endif
+#endif
+#ifndef OUTCOME_USE_TYPE_TRAIT_BUILTINS
+#define OUTCOME_USE_TYPE_TRAIT_BUILTINS 0
+#endif
+
+#ifndef OUTCOME_IS_TRIVIALLY_RELOCATABLE
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_cpp_trivially_relocatable)
+//! Expands to the compiler's trivially relocatable type trait builtin, or `false` if it has none.
+#define OUTCOME_IS_TRIVIALLY_RELOCATABLE(...) __builtin_is_cpp_trivially_relocatable(__VA_ARGS__)
+#elif __has_builtin(__is_trivially_relocatable)
+#define OUTCOME_IS_TRIVIALLY_RELOCATABLE(...) __is_trivially_relocatable(__VA_ARGS__)
+#endif
+#endif
+#endif
+#ifndef OUTCOME_IS_TRIVIALLY_RELOCATABLE
+#define OUTCOME_IS_TRIVIALLY_RELOCATABLE(...) false
+#endif
+
 OUTCOME_V2_NAMESPACE_BEGIN
 namespace detail
 {
@@ -244,7 +273,28 @@ namespace detail
 
   /* True if type is the same or constructible. Works around a bug where clang + libstdc++
   pukes on std::is_constructible<filesystem::path, void> (this bug is fixed upstream).
+
+  These are evaluated many times for every basic_result and basic_outcome instantiated,
+  so if the compiler has the type trait builtins we use those directly rather than
+  instantiate the std trait class templates.
   */
+#if OUTCOME_USE_TYPE_TRAIT_BUILTINS
+  template <class T, class U> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_explicitly_constructible = __is_constructible(T, U);
+  template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_explicitly_constructible<T, void> = false;
+
+  template <class T, class U> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_implicitly_constructible = std::is_convertible<U, T>::value;
+  template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_implicitly_constructible<T, void> = false;
+
+#if defined(_MSC_VER) || defined(__clang__) || __GNUC__ >= 11  // not reported by __has_builtin before GCC 14
+  template <class T, class... Args> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_nothrow_constructible = __is_nothrow_constructible(T, Args...);
+#else
+  template <class T, class... Args> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_nothrow_constructible = std::is_nothrow_constructible<T, Args...>::value;
+#endif
+  template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_nothrow_constructible<T, void> = false;
+
+  template <class T, class... Args> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_constructible = __is_constructible(T, Args...);
+  template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_constructible<T, void> = false;
+#else
   template <class T, class U> struct _is_explicitly_constructible
   {
     static constexpr bool value = std::is_constructible<T, U>::value;
@@ -257,7 +307,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
+  template <class T, class U> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
 
   template <class T, class U> struct _is_implicitly_constructible
   {
@@ -271,7 +321,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
+  template <class T, class U> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
 
   template <class T, class... Args> struct _is_nothrow_constructible
   {
@@ -285,7 +335,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class... Args> static constexpr bool is_nothrow_constructible = _is_nothrow_constructible<T, Args...>::value;
+  template <class T, class... Args> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_nothrow_constructible = _is_nothrow_constructible<T, Args...>::value;
 
   template <class T, class... Args> struct _is_constructible
   {
@@ -299,7 +349,8 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class... Args> static constexpr bool is_constructible = _is_constructible<T, Args...>::value;
+  template <class T, class... Args> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_constructible = _is_constructible<T, Args...>::value;
+#endif
 
 #ifndef OUTCOME_USE_STD_IS_NOTHROW_SWAPPABLE
 #if defined(_MSC_VER) && _HAS_CXX17
@@ -381,6 +432,43 @@ OUTCOME_V2_NAMESPACE_END
 #endif
 #endif
 
+#ifndef OUTCOME_ENABLE_USDT
+#define OUTCOME_ENABLE_USDT 0  // set to 1 to place USDT static probes for bpftrace, systemtap etc
+#endif
+#if OUTCOME_ENABLE_USDT
+#include "detail/usdt.hpp"
+#endif
+
+#ifndef OUTCOME_ENABLE_MOVED_FROM_CHECKS
+#define OUTCOME_ENABLE_MOVED_FROM_CHECKS 0  // set to 1 in checked builds to trap reads of moved-from result and outcome
+#endif
+#if OUTCOME_ENABLE_MOVED_FROM_CHECKS
+#include "detail/moved_from_checks.hpp"
+#else
+#define OUTCOME_MOVED_FROM_SITE_PARAMETER
+#define OUTCOME_CHECK_MOVED_FROM(observer)
+#endif
+
+#ifndef OUTCOME_FORCE_INLINE_OBSERVERS
+#define OUTCOME_FORCE_INLINE_OBSERVERS 0  // set to 1 in debug builds to inline the layers beneath has_value(), value() etc even at -O0
+#endif
+#ifndef OUTCOME_OBSERVER_INLINE
+#if !OUTCOME_FORCE_INLINE_OBSERVERS
+#define OUTCOME_OBSERVER_INLINE
+#elif defined(__clang__)
+//! Marks the thin layers beneath the observers as always inlined if `OUTCOME_FORCE_INLINE_OBSERVERS` is `1`. Usually automatic, can be overriden.
+#define OUTCOME_OBSERVER_INLINE __attribute__((always_inline))
+#elif defined(__GNUC__)
+// artificial makes the debugger step over the inlined layers, as if they were not there
+#define OUTCOME_OBSERVER_INLINE __attribute__((always_inline, artificial))
+#elif defined(_MSC_VER)
+// MSVC ignores __forceinline under /Ob0, so debug builds also need /Ob1
+#define OUTCOME_OBSERVER_INLINE __forceinline
+#else
+#define OUTCOME_OBSERVER_INLINE
+#endif
+#endif
+
 #ifndef BOOST_OUTCOME_AUTO_TEST_CASE
 #define BOOST_OUTCOME_AUTO_TEST_CASE(a, b) BOOST_AUTO_TEST_CASE(a, b)
 #endif
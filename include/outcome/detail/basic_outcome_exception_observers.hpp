@@ -37,15 +37,15 @@ namespace detail
     using exception_type = P;
     using Base::Base;
 
-    constexpr inline exception_type &assume_exception() & noexcept;
-    constexpr inline const exception_type &assume_exception() const & noexcept;
-    constexpr inline exception_type &&assume_exception() && noexcept;
-    constexpr inline const exception_type &&assume_exception() const && noexcept;
-
-    constexpr inline exception_type &exception() &;
-    constexpr inline const exception_type &exception() const &;
-    constexpr inline exception_type &&exception() &&;
-    constexpr inline const exception_type &&exception() const &&;
+    OUTCOME_OBSERVER_INLINE constexpr inline exception_type &assume_exception() & noexcept;
+    OUTCOME_OBSERVER_INLINE constexpr inline const exception_type &assume_exception() const & noexcept;
+    OUTCOME_OBSERVER_INLINE constexpr inline exception_type &&assume_exception() && noexcept;
+    OUTCOME_OBSERVER_INLINE constexpr inline const exception_type &&assume_exception() const && noexcept;
+
+    OUTCOME_OBSERVER_INLINE constexpr inline exception_type &exception() &;
+    OUTCOME_OBSERVER_INLINE constexpr inline const exception_type &exception() const &;
+    OUTCOME_OBSERVER_INLINE constexpr inline exception_type &&exception() &&;
+    OUTCOME_OBSERVER_INLINE constexpr inline const exception_type &&exception() const &&;
   };
 
   // Exception observers not present
@@ -54,15 +54,15 @@ namespace detail
   public:
     using Base::Base;
 
-    constexpr void assume_exception() & noexcept { NoValuePolicy::narrow_exception_check(*this); }
-    constexpr void assume_exception() const & noexcept { NoValuePolicy::narrow_exception_check(*this); }
-    constexpr void assume_exception() && noexcept { NoValuePolicy::narrow_exception_check(std::move(*this)); }
-    constexpr void assume_exception() const && noexcept { NoValuePolicy::narrow_exception_check(std::move(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_exception() & noexcept { NoValuePolicy::narrow_exception_check(*this); }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_exception() const & noexcept { NoValuePolicy::narrow_exception_check(*this); }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_exception() && noexcept { NoValuePolicy::narrow_exception_check(std::move(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_exception() const && noexcept { NoValuePolicy::narrow_exception_check(std::move(*this)); }
 
-    constexpr void exception() & { NoValuePolicy::wide_exception_check(*this); }
-    constexpr void exception() const & { NoValuePolicy::wide_exception_check(*this); }
-    constexpr void exception() && { NoValuePolicy::wide_exception_check(std::move(*this)); }
-    constexpr void exception() const && { NoValuePolicy::wide_exception_check(std::move(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void exception() & { NoValuePolicy::wide_exception_check(*this); }
+    OUTCOME_OBSERVER_INLINE constexpr void exception() const & { NoValuePolicy::wide_exception_check(*this); }
+    OUTCOME_OBSERVER_INLINE constexpr void exception() && { NoValuePolicy::wide_exception_check(std::move(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void exception() const && { NoValuePolicy::wide_exception_check(std::move(*this)); }
   };
 
 }  // namespace detail
@@ -35,16 +35,18 @@ namespace policy
 {
   template <class R, class S, class P, class NoValuePolicy, class Impl> inline constexpr auto &&base::_exception(Impl &&self) noexcept
   {
-    // Impl will be some internal implementation class which has no knowledge of the _ptr stored
+    // Impl will be some internal implementation class which has no knowledge of the exception stored
     // beneath it. So statically cast, preserving rvalue and constness, to the derived class.
-    using Outcome = OUTCOME_V2_NAMESPACE::detail::rebind_type<basic_outcome<R, S, P, NoValuePolicy>, decltype(self)>;
+    // NoValuePolicy may be wrapped by another policy (e.g. policy::error_trace), so use the one Impl was really instantiated with.
+    using _policy = typename std::decay_t<Impl>::_no_value_policy_type;
+    using Outcome = OUTCOME_V2_NAMESPACE::detail::rebind_type<basic_outcome<R, S, P, _policy>, decltype(self)>;
 #if defined(_MSC_VER) && _MSC_VER < 1920
     // VS2017 tries a copy construction in the correct implementation despite that Outcome is always a rvalue or lvalue ref! :(
-    basic_outcome<R, S, P, NoValuePolicy> &_self = (basic_outcome<R, S, P, NoValuePolicy> &) (self);  // NOLINT
+    basic_outcome<R, S, P, _policy> &_self = (basic_outcome<R, S, P, _policy> &) (self);  // NOLINT
 #else
     Outcome _self = static_cast<Outcome>(self);  // NOLINT
 #endif
-    return static_cast<Outcome>(_self)._ptr;
+    return static_cast<Outcome>(_self)._exception_ref();
   }
 }  // namespace policy
 
@@ -37,44 +37,52 @@ namespace detail
     using error_type = EC;
     using Base::Base;
 
-    constexpr error_type &assume_error() & noexcept
+    OUTCOME_OBSERVER_INLINE constexpr error_type &assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) & noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
       NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &>(*this));
       return this->_state._error;
     }
-    constexpr const error_type &assume_error() const & noexcept
+    OUTCOME_OBSERVER_INLINE constexpr const error_type &assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const & noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
       NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &>(*this));
       return this->_state._error;
     }
-    constexpr error_type &&assume_error() && noexcept
+    OUTCOME_OBSERVER_INLINE constexpr error_type &&assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) && noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
       NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &&>(*this));
       return static_cast<error_type &&>(this->_state._error);
     }
-    constexpr const error_type &&assume_error() const && noexcept
+    OUTCOME_OBSERVER_INLINE constexpr const error_type &&assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const && noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
       NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &&>(*this));
       return static_cast<const error_type &&>(this->_state._error);
     }
 
-    constexpr error_type &error() &
+    OUTCOME_OBSERVER_INLINE constexpr error_type &error(OUTCOME_MOVED_FROM_SITE_PARAMETER) &
     {
+      OUTCOME_CHECK_MOVED_FROM("error");
       NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &>(*this));
       return this->_state._error;
     }
-    constexpr const error_type &error() const &
+    OUTCOME_OBSERVER_INLINE constexpr const error_type &error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &
     {
+      OUTCOME_CHECK_MOVED_FROM("error");
       NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &>(*this));
       return this->_state._error;
     }
-    constexpr error_type &&error() &&
+    OUTCOME_OBSERVER_INLINE constexpr error_type &&error(OUTCOME_MOVED_FROM_SITE_PARAMETER) &&
     {
+      OUTCOME_CHECK_MOVED_FROM("error");
       NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &&>(*this));
       return static_cast<error_type &&>(this->_state._error);
     }
-    constexpr const error_type &&error() const &&
+    OUTCOME_OBSERVER_INLINE constexpr const error_type &&error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &&
     {
+      OUTCOME_CHECK_MOVED_FROM("error");
       NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &&>(*this));
       return static_cast<const error_type &&>(this->_state._error);
     }
@@ -84,15 +92,47 @@ namespace detail
   public:
     using Base::Base;
 
-    constexpr void assume_error() & noexcept { NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &>(*this)); }
-    constexpr void assume_error() const & noexcept { NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &>(*this)); }
-    constexpr void assume_error() && noexcept { NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &&>(*this)); }
-    constexpr void assume_error() const && noexcept { NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &&>(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) & noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
+      NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const & noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
+      NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) && noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
+      NoValuePolicy::narrow_error_check(static_cast<basic_result_error_observers &&>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const && noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_error");
+      NoValuePolicy::narrow_error_check(static_cast<const basic_result_error_observers &&>(*this));
+    }
 
-    constexpr void error() & { NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &>(*this)); }
-    constexpr void error() const & { NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &>(*this)); }
-    constexpr void error() && { NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &&>(*this)); }
-    constexpr void error() const && { NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &&>(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void error(OUTCOME_MOVED_FROM_SITE_PARAMETER) &
+    {
+      OUTCOME_CHECK_MOVED_FROM("error");
+      NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &
+    {
+      OUTCOME_CHECK_MOVED_FROM("error");
+      NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void error(OUTCOME_MOVED_FROM_SITE_PARAMETER) &&
+    {
+      OUTCOME_CHECK_MOVED_FROM("error");
+      NoValuePolicy::wide_error_check(static_cast<basic_result_error_observers &&>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void error(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &&
+    {
+      OUTCOME_CHECK_MOVED_FROM("error");
+      NoValuePolicy::wide_error_check(static_cast<const basic_result_error_observers &&>(*this));
+    }
   };
 }  // namespace detail
 OUTCOME_V2_NAMESPACE_END
@@ -53,7 +53,7 @@ namespace detail
   template <class R, class EC, class NoValuePolicy>  //
   class basic_result_storage
   {
-    static_assert(trait::type_can_be_used_in_basic_result<R>, "The type R cannot be used in a basic_result");
+    static_assert(trait::type_can_be_used_in_basic_result<typename value_storage_type_of<R>::type>, "The type R cannot be used in a basic_result");
     static_assert(trait::type_can_be_used_in_basic_result<EC>, "The type S cannot be used in a basic_result");
 
     friend struct policy::base;
@@ -76,7 +76,11 @@ namespace detail
     using _value_type = std::conditional_t<std::is_same<R, EC>::value, disable_in_place_value_type, R>;
     using _error_type = std::conditional_t<std::is_same<R, EC>::value, disable_in_place_error_type, EC>;
 
-    using _state_type = value_storage_select_impl<_value_type, _error_type>;
+    // A reference is stored as a pointer
+    using _stored_value_type = typename value_storage_type_of<_value_type>::type;
+    using _state_type = typename value_storage_select_state<_stored_value_type, _error_type, NoValuePolicy>::type;
+    // The policy actually in use, which may wrap the policy a subclass was written against
+    using _no_value_policy_type = NoValuePolicy;
 
 #ifdef STANDARDESE_IS_IN_THE_HOUSE
     value_storage_trivial<_value_type, _error_type> _state;
@@ -98,15 +102,15 @@ namespace detail
     ~basic_result_storage() = default;
 
     template <class... Args>
-    constexpr explicit basic_result_storage(in_place_type_t<_value_type> _,
+    constexpr explicit basic_result_storage(in_place_type_t<_value_type> /*unused*/,
                                             Args &&... args) noexcept(detail::is_nothrow_constructible<_value_type, Args...>)
-        : _state{_, static_cast<Args &&>(args)...}
+        : _state{in_place_type<_stored_value_type>, static_cast<Args &&>(args)...}
     {
     }
     template <class U, class... Args>
-    constexpr basic_result_storage(in_place_type_t<_value_type> _, std::initializer_list<U> il,
+    constexpr basic_result_storage(in_place_type_t<_value_type> /*unused*/, std::initializer_list<U> il,
                                    Args &&... args) noexcept(detail::is_nothrow_constructible<_value_type, std::initializer_list<U>, Args...>)
-        : _state{_, il, static_cast<Args &&>(args)...}
+        : _state{in_place_type<_stored_value_type>, il, static_cast<Args &&>(args)...}
     {
     }
     template <class... Args>
@@ -144,14 +148,14 @@ namespace detail
     template <class T, class U, class V>
     constexpr basic_result_storage(make_error_code_compatible_conversion_tag /*unused*/, const basic_result_storage<T, U, V> &o) noexcept(
     detail::is_nothrow_constructible<_value_type, T> &&noexcept(make_error_code(std::declval<U>())))
-        : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, o._state._value) :
+        : _state(status_of(o._state).have_value() ? _state_type(in_place_type<_stored_value_type>, value_of(o._state)) :
                                                  _state_type(in_place_type<_error_type>, make_error_code(o._state._error)))
     {
     }
     template <class T, class U, class V>
     constexpr basic_result_storage(make_error_code_compatible_conversion_tag /*unused*/, basic_result_storage<T, U, V> &&o) noexcept(
     detail::is_nothrow_constructible<_value_type, T> &&noexcept(make_error_code(std::declval<U>())))
-        : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, static_cast<T &&>(o._state._value)) :
+        : _state(status_of(o._state).have_value() ? _state_type(in_place_type<_stored_value_type>, static_cast<T &&>(value_of(o._state))) :
                                                  _state_type(in_place_type<_error_type>, make_error_code(static_cast<U &&>(o._state._error))))
     {
     }
@@ -162,14 +166,14 @@ namespace detail
     template <class T, class U, class V>
     constexpr basic_result_storage(make_exception_ptr_compatible_conversion_tag /*unused*/, const basic_result_storage<T, U, V> &o) noexcept(
     detail::is_nothrow_constructible<_value_type, T> &&noexcept(make_exception_ptr(std::declval<U>())))
-        : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, o._state._value) :
+        : _state(status_of(o._state).have_value() ? _state_type(in_place_type<_stored_value_type>, value_of(o._state)) :
                                                  _state_type(in_place_type<_error_type>, make_exception_ptr(o._state._error)))
     {
     }
     template <class T, class U, class V>
     constexpr basic_result_storage(make_exception_ptr_compatible_conversion_tag /*unused*/, basic_result_storage<T, U, V> &&o) noexcept(
     detail::is_nothrow_constructible<_value_type, T> &&noexcept(make_exception_ptr(std::declval<U>())))
-        : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, static_cast<T &&>(o._state._value)) :
+        : _state(status_of(o._state).have_value() ? _state_type(in_place_type<_stored_value_type>, static_cast<T &&>(value_of(o._state))) :
                                                  _state_type(in_place_type<_error_type>, make_exception_ptr(static_cast<U &&>(o._state._error))))
     {
     }
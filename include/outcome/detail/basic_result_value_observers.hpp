@@ -33,66 +33,113 @@ namespace detail
 {
   template <class Base, class R, class NoValuePolicy> class basic_result_value_observers : public Base
   {
+  protected:
+    using _value_lref = std::conditional_t<is_value_read_only<typename Base::_state_type>::value, const R &, R &>;
+    using _value_rref = std::conditional_t<is_value_read_only<typename Base::_state_type>::value, const R &&, R &&>;
+
   public:
     using value_type = R;
     using Base::Base;
 
-    constexpr value_type &assume_value() & noexcept
+    OUTCOME_OBSERVER_INLINE constexpr _value_lref assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) & noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
       NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &>(*this));
-      return this->_state._value;  // NOLINT
+      return value_of(this->_state);  // NOLINT
     }
-    constexpr const value_type &assume_value() const & noexcept
+    OUTCOME_OBSERVER_INLINE constexpr const value_type &assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const & noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
       NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &>(*this));
-      return this->_state._value;  // NOLINT
+      return value_of(this->_state);  // NOLINT
     }
-    constexpr value_type &&assume_value() && noexcept
+    OUTCOME_OBSERVER_INLINE constexpr _value_rref assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) && noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
       NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &&>(*this));
-      return static_cast<value_type &&>(this->_state._value);  // NOLINT
+      return static_cast<_value_rref>(value_of(this->_state));  // NOLINT
     }
-    constexpr const value_type &&assume_value() const && noexcept
+    OUTCOME_OBSERVER_INLINE constexpr const value_type &&assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const && noexcept
     {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
       NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &&>(*this));
-      return static_cast<const value_type &&>(this->_state._value);  // NOLINT
+      return static_cast<const value_type &&>(value_of(this->_state));  // NOLINT
     }
 
-    constexpr value_type &value() &
+    OUTCOME_OBSERVER_INLINE constexpr _value_lref value(OUTCOME_MOVED_FROM_SITE_PARAMETER) &
     {
+      OUTCOME_CHECK_MOVED_FROM("value");
       NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &>(*this));
-      return this->_state._value;  // NOLINT
+      return value_of(this->_state);  // NOLINT
     }
-    constexpr const value_type &value() const &
+    OUTCOME_OBSERVER_INLINE constexpr const value_type &value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &
     {
+      OUTCOME_CHECK_MOVED_FROM("value");
       NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &>(*this));
-      return this->_state._value;  // NOLINT
+      return value_of(this->_state);  // NOLINT
     }
-    constexpr value_type &&value() &&
+    OUTCOME_OBSERVER_INLINE constexpr _value_rref value(OUTCOME_MOVED_FROM_SITE_PARAMETER) &&
     {
+      OUTCOME_CHECK_MOVED_FROM("value");
       NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &&>(*this));
-      return static_cast<value_type &&>(this->_state._value);  // NOLINT
+      return static_cast<_value_rref>(value_of(this->_state));  // NOLINT
     }
-    constexpr const value_type &&value() const &&
+    OUTCOME_OBSERVER_INLINE constexpr const value_type &&value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &&
     {
+      OUTCOME_CHECK_MOVED_FROM("value");
       NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &&>(*this));
-      return static_cast<const value_type &&>(this->_state._value);  // NOLINT
+      return static_cast<const value_type &&>(value_of(this->_state));  // NOLINT
     }
   };
   template <class Base, class NoValuePolicy> class basic_result_value_observers<Base, void, NoValuePolicy> : public Base
   {
+  protected:
+    using _value_lref = void;
+
   public:
     using Base::Base;
 
-    constexpr void assume_value() & noexcept { NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &>(*this)); }
-    constexpr void assume_value() const & noexcept { NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &>(*this)); }
-    constexpr void assume_value() && noexcept { NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &&>(*this)); }
-    constexpr void assume_value() const && noexcept { NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &&>(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) & noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
+      NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const & noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
+      NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) && noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
+      NoValuePolicy::narrow_value_check(static_cast<basic_result_value_observers &&>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void assume_value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const && noexcept
+    {
+      OUTCOME_CHECK_MOVED_FROM("assume_value");
+      NoValuePolicy::narrow_value_check(static_cast<const basic_result_value_observers &&>(*this));
+    }
 
-    constexpr void value() & { NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &>(*this)); }
-    constexpr void value() const & { NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &>(*this)); }
-    constexpr void value() && { NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &&>(*this)); }
-    constexpr void value() const && { NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &&>(*this)); }
+    OUTCOME_OBSERVER_INLINE constexpr void value(OUTCOME_MOVED_FROM_SITE_PARAMETER) &
+    {
+      OUTCOME_CHECK_MOVED_FROM("value");
+      NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &
+    {
+      OUTCOME_CHECK_MOVED_FROM("value");
+      NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void value(OUTCOME_MOVED_FROM_SITE_PARAMETER) &&
+    {
+      OUTCOME_CHECK_MOVED_FROM("value");
+      NoValuePolicy::wide_value_check(static_cast<basic_result_value_observers &&>(*this));
+    }
+    OUTCOME_OBSERVER_INLINE constexpr void value(OUTCOME_MOVED_FROM_SITE_PARAMETER) const &&
+    {
+      OUTCOME_CHECK_MOVED_FROM("value");
+      NoValuePolicy::wide_value_check(static_cast<const basic_result_value_observers &&>(*this));
+    }
   };
 }  // namespace detail
 
@@ -215,6 +215,9 @@ namespace awaitables
         }
         new(&result) container_type(static_cast<container_type &&>(value));  // could throw
         result_set.store(true, std::memory_order_release);
+#if OUTCOME_ENABLE_USDT
+        OUTCOME_V2_NAMESPACE::detail::usdt_coroutine_complete(this, result);
+#endif
       }
       void return_value(const container_type &value)
       {
@@ -226,6 +229,9 @@ namespace awaitables
         }
         new(&result) container_type(value);  // could throw
         result_set.store(true, std::memory_order_release);
+#if OUTCOME_ENABLE_USDT
+        OUTCOME_V2_NAMESPACE::detail::usdt_coroutine_complete(this, result);
+#endif
       }
       void unhandled_exception()
       {
@@ -247,6 +253,9 @@ namespace awaitables
         std::terminate();
 #endif
         result_set.store(true, std::memory_order_release);
+#if OUTCOME_ENABLE_USDT
+        OUTCOME_V2_NAMESPACE::detail::usdt_coroutine_complete(this, result);
+#endif
       }
       auto initial_suspend() noexcept
       {
@@ -324,6 +333,9 @@ namespace awaitables
         OUTCOME_V2_AWAITABLES_DEBUG_PRINTER(this << " promise returns void");
         OUTCOME_ASSERT(!result_set.load(std::memory_order_acquire));
         result_set.store(true, std::memory_order_release);
+#if OUTCOME_ENABLE_USDT
+        OUTCOME_V2_NAMESPACE::detail::usdt_coroutine_complete(this);
+#endif
       }
       void unhandled_exception()
       {
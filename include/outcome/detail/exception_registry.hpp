@@ -0,0 +1,225 @@
+/* Registry mapping exception types to error codes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_EXCEPTION_REGISTRY_HPP
+#define OUTCOME_DETAIL_EXCEPTION_REGISTRY_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstring>  // for memcpy
+#include <exception>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <typeinfo>
+
+//! The maximum number of exception types which can be registered, including the standard ones
+#ifndef OUTCOME_EXCEPTION_REGISTRY_SIZE
+#define OUTCOME_EXCEPTION_REGISTRY_SIZE 64
+#endif
+
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+#define OUTCOME_EXCEPTION_REGISTRY_RTTI 1
+#else
+#define OUTCOME_EXCEPTION_REGISTRY_RTTI 0
+#endif
+
+// The dynamic type of an arbitrary exception_ptr can only be had from libstdc++. Elsewhere on the Itanium ABI
+// it can be had if the exception_ptr is the exception currently being handled, which is the usual case.
+#ifndef OUTCOME_EXCEPTION_REGISTRY_ITANIUM
+#if(defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)) && OUTCOME_EXCEPTION_REGISTRY_RTTI && defined(__has_include)
+#if __has_include(<cxxabi.h>)
+#define OUTCOME_EXCEPTION_REGISTRY_ITANIUM 1
+#endif
+#endif
+#endif
+#ifndef OUTCOME_EXCEPTION_REGISTRY_ITANIUM
+#define OUTCOME_EXCEPTION_REGISTRY_ITANIUM 0
+#endif
+
+#if OUTCOME_EXCEPTION_REGISTRY_ITANIUM
+#include <cxxabi.h>
+#endif
+
+#if OUTCOME_EXCEPTION_REGISTRY_RTTI
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  using exception_registry_generic_function = void (*)();
+
+  struct exception_registry_entry
+  {
+    const std::type_info *type;
+    // Either ec is returned, or if invoke is set it is called with fn and the thrown object
+    std::error_code (*invoke)(exception_registry_generic_function fn, const void *object);
+    exception_registry_generic_function fn;
+    std::error_code ec;
+  };
+
+  template <class E> inline std::error_code exception_registry_invoke(exception_registry_generic_function fn, const void *object)
+  {
+    return reinterpret_cast<std::error_code (*)(const E &)>(fn)(*static_cast<const E *>(object));  // NOLINT
+  }
+
+  // Entries are only ever appended. Each is written before the count is published, so lookups need no lock.
+  class exception_registry
+  {
+    std::mutex _lock;
+    std::atomic<size_t> _count{0};
+    exception_registry_entry _entries[OUTCOME_EXCEPTION_REGISTRY_SIZE];
+
+    static std::error_code _system_error_code(const std::system_error &e) { return e.code(); }
+
+  public:
+    exception_registry() noexcept
+    {
+      // The same mapping as the catch clauses of error_from_exception()
+      add(typeid(std::invalid_argument), nullptr, nullptr, std::make_error_code(std::errc::invalid_argument));
+      add(typeid(std::domain_error), nullptr, nullptr, std::make_error_code(std::errc::argument_out_of_domain));
+      add(typeid(std::length_error), nullptr, nullptr, std::make_error_code(std::errc::argument_list_too_long));
+      add(typeid(std::out_of_range), nullptr, nullptr, std::make_error_code(std::errc::result_out_of_range));
+      add(typeid(std::logic_error), nullptr, nullptr, std::make_error_code(std::errc::invalid_argument));
+      add(typeid(std::system_error), &exception_registry_invoke<std::system_error>,
+          reinterpret_cast<exception_registry_generic_function>(&_system_error_code), {});  // NOLINT
+      add(typeid(std::overflow_error), nullptr, nullptr, std::make_error_code(std::errc::value_too_large));
+      add(typeid(std::range_error), nullptr, nullptr, std::make_error_code(std::errc::result_out_of_range));
+      add(typeid(std::runtime_error), nullptr, nullptr, std::make_error_code(std::errc::resource_unavailable_try_again));
+      add(typeid(std::bad_alloc), nullptr, nullptr, std::make_error_code(std::errc::not_enough_memory));
+    }
+    exception_registry(const exception_registry &) = delete;
+    exception_registry(exception_registry &&) = delete;
+    exception_registry &operator=(const exception_registry &) = delete;
+    exception_registry &operator=(exception_registry &&) = delete;
+    ~exception_registry() = default;
+
+    bool add(const std::type_info &type, std::error_code (*invoke)(exception_registry_generic_function, const void *), exception_registry_generic_function fn,
+             std::error_code ec) noexcept
+    {
+      std::lock_guard<std::mutex> g(_lock);
+      const size_t n = _count.load(std::memory_order_relaxed);
+      if(n == OUTCOME_EXCEPTION_REGISTRY_SIZE)
+      {
+        return false;
+      }
+      _entries[n] = {&type, invoke, fn, ec};
+      _count.store(n + 1, std::memory_order_release);
+      return true;
+    }
+
+    // Later registrations take precedence, so users may override the standard mappings
+    const exception_registry_entry *find(const std::type_info &type) const noexcept
+    {
+      for(size_t n = _count.load(std::memory_order_acquire); n > 0; n--)
+      {
+        const auto &e = _entries[n - 1];
+        if(e.type == &type || *e.type == type)
+        {
+          return &e;
+        }
+      }
+      return nullptr;
+    }
+  };
+
+  inline exception_registry &exception_registry_instance() noexcept
+  {
+    static exception_registry v;
+    return v;
+  }
+
+  enum class exception_classification
+  {
+    matched,
+    not_matched,  // the exception cannot match any registered type
+    unknown       // the exception's type could not be inspected, fall back to rethrowing it
+  };
+
+#if OUTCOME_EXCEPTION_REGISTRY_ITANIUM
+  inline const std::type_info *exception_registry_dynamic_type(const std::exception_ptr &ep) noexcept
+  {
+#if defined(__GLIBCXX__)
+    return ep.__cxa_exception_type();
+#else
+    return (ep == std::current_exception()) ? abi::__cxa_current_exception_type() : nullptr;
+#endif
+  }
+#endif
+
+  inline exception_classification classify_exception(const std::exception_ptr &ep, std::error_code &out) noexcept
+  {
+#if OUTCOME_EXCEPTION_REGISTRY_ITANIUM
+    const std::type_info *type = exception_registry_dynamic_type(ep);
+    if(type == nullptr)
+    {
+      return exception_classification::unknown;
+    }
+    // On the Itanium ABI the exception_ptr is a pointer to the thrown object
+    static_assert(sizeof(std::exception_ptr) == sizeof(void *), "exception_ptr is not a single pointer");
+    const void *object;
+    memcpy(&object, &ep, sizeof(object));  // NOLINT
+    const auto &registry = exception_registry_instance();
+    // Single non-virtual public bases are at offset zero, so the same object pointer serves for each base
+    for(;;)
+    {
+      const exception_registry_entry *e = registry.find(*type);
+      if(e != nullptr)
+      {
+        out = (e->invoke != nullptr) ? e->invoke(e->fn, object) : e->ec;
+        return exception_classification::matched;
+      }
+#if !defined(__GLIBCXX__)
+      // Only libstdc++'s <cxxabi.h> declares the class type_info layouts, so elsewhere only exact types match
+      return exception_classification::unknown;
+#else
+      // Compared by typeid rather than dynamic_cast, which GCC 12 cannot export from a module
+      const std::type_info &kind = typeid(*type);
+      if(kind == typeid(abi::__si_class_type_info))
+      {
+        type = static_cast<const abi::__si_class_type_info *>(type)->__base_type;
+        continue;
+      }
+      if(kind == typeid(abi::__vmi_class_type_info))
+      {
+        // Multiple or virtual inheritance, leave it to the compiler's catch matching
+        return exception_classification::unknown;
+      }
+      // Base of the hierarchy, or not a class, so no catch clause could match it either
+      return exception_classification::not_matched;
+#endif
+    }
+#else
+    (void) ep;
+    (void) out;
+    return exception_classification::unknown;
+#endif
+  }
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+#endif  // OUTCOME_EXCEPTION_REGISTRY_RTTI
+
+#endif
@@ -0,0 +1,95 @@
+/* Construction hooks shared by the policies which observe failures
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_FAILURE_HOOKS_HPP
+#define OUTCOME_DETAIL_FAILURE_HOOKS_HPP
+
+#include "../policy/base.hpp"
+#include "failure_info.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#pragma intrinsic(_ReturnAddress)
+#define OUTCOME_ERROR_TRACE_RETURN_ADDRESS() _ReturnAddress()
+#else
+#define OUTCOME_ERROR_TRACE_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  /* Forwards every construction hook to Base, then calls `Derived::_on_construction(inst, return_address)`.
+  Everything is forced inline, so the return address is that of the innermost non-inlined function which
+  constructed the `result` or `outcome`. `Derived` must befriend this class if its hook is not public.
+  */
+  template <class Derived, class Base> struct failure_hooks : Base
+  {
+    template <class T, class U> OUTCOME_FORCEINLINE static void on_result_construction(T *inst, U &&v) noexcept
+    {
+      Base::on_result_construction(inst, static_cast<U &&>(v));
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+    template <class T, class U> OUTCOME_FORCEINLINE static void on_result_copy_construction(T *inst, U &&v) noexcept
+    {
+      Base::on_result_copy_construction(inst, static_cast<U &&>(v));
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+    template <class T, class U> OUTCOME_FORCEINLINE static void on_result_move_construction(T *inst, U &&v) noexcept
+    {
+      Base::on_result_move_construction(inst, static_cast<U &&>(v));
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+    template <class T, class U, class... Args>
+    OUTCOME_FORCEINLINE static void on_result_in_place_construction(T *inst, in_place_type_t<U> _, Args &&... args) noexcept
+    {
+      Base::on_result_in_place_construction(inst, _, static_cast<Args &&>(args)...);
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+
+    template <class T, class... U> OUTCOME_FORCEINLINE static void on_outcome_construction(T *inst, U &&... args) noexcept
+    {
+      Base::on_outcome_construction(inst, static_cast<U &&>(args)...);
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+    template <class T, class U> OUTCOME_FORCEINLINE static void on_outcome_copy_construction(T *inst, U &&v) noexcept
+    {
+      Base::on_outcome_copy_construction(inst, static_cast<U &&>(v));
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+    template <class T, class U> OUTCOME_FORCEINLINE static void on_outcome_move_construction(T *inst, U &&v) noexcept
+    {
+      Base::on_outcome_move_construction(inst, static_cast<U &&>(v));
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+    template <class T, class U, class... Args>
+    OUTCOME_FORCEINLINE static void on_outcome_in_place_construction(T *inst, in_place_type_t<U> _, Args &&... args) noexcept
+    {
+      Base::on_outcome_in_place_construction(inst, _, static_cast<Args &&>(args)...);
+      Derived::_on_construction(inst, OUTCOME_ERROR_TRACE_RETURN_ADDRESS());
+    }
+  };
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,71 @@
+/* Extraction of the type and error of a failure, shared by the tracing facilities
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_FAILURE_INFO_HPP
+#define OUTCOME_DETAIL_FAILURE_INFO_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  // A per-type string which names T, without needing RTTI
+  template <class T> inline const char *type_signature() noexcept
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+  }
+
+  // Overloads taking a higher priority are preferred when viable
+  template <int N> struct priority : priority<N - 1>
+  {
+  };
+  template <> struct priority<0>
+  {
+  };
+
+  struct error_info
+  {
+    const char *domain;  // Category name of the error, or null if not available
+    int64_t value;       // Integral error value, or zero if not available
+  };
+  template <class E>
+  inline auto extract_error_info(const E &e, priority<2> /*unused*/) noexcept -> decltype(static_cast<int64_t>(e.value()), e.category().name(), error_info())
+  {
+    return {e.category().name(), static_cast<int64_t>(e.value())};
+  }
+  template <class E, typename std::enable_if<std::is_integral<E>::value || std::is_enum<E>::value, bool>::type = true>
+  inline error_info extract_error_info(const E &e, priority<1> /*unused*/) noexcept
+  {
+    return {nullptr, static_cast<int64_t>(e)};
+  }
+  template <class E> inline error_info extract_error_info(const E & /*unused*/, priority<0> /*unused*/) noexcept { return {nullptr, 0}; }
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,116 @@
+/* Checked build detection of reads of moved-from result and outcome
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_MOVED_FROM_CHECKS_HPP
+#define OUTCOME_DETAIL_MOVED_FROM_CHECKS_HPP
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1926)
+#define OUTCOME_MOVED_FROM_SITE_FILE __builtin_FILE()
+#define OUTCOME_MOVED_FROM_SITE_LINE __builtin_LINE()
+#define OUTCOME_MOVED_FROM_SITE_FUNCTION __builtin_FUNCTION()
+#else
+#define OUTCOME_MOVED_FROM_SITE_FILE "unknown"
+#define OUTCOME_MOVED_FROM_SITE_LINE 0
+#define OUTCOME_MOVED_FROM_SITE_FUNCTION "unknown"
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  moved_from_site. Potential doc page: NOT FOUND
+*/
+struct moved_from_site
+{
+  const char *file;      // Source file of the read of the moved-from object
+  unsigned line;         // Source line of the read
+  const char *function;  // Function which did the read
+  const char *observer;  // Which observer was called, e.g. "value"
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias moved_from_handler. Potential doc page: NOT FOUND
+*/
+using moved_from_handler = void (*)(const moved_from_site &site);
+
+namespace detail
+{
+  // Default arguments are evaluated at the call site of the observer, so this captures where user code read the object
+  struct moved_from_site_here
+  {
+    const char *file;
+    unsigned line;
+    const char *function;
+    constexpr moved_from_site_here(const char *_file = OUTCOME_MOVED_FROM_SITE_FILE, unsigned _line = OUTCOME_MOVED_FROM_SITE_LINE,
+                                   const char *_function = OUTCOME_MOVED_FROM_SITE_FUNCTION) noexcept
+        : file(_file)
+        , line(_line)
+        , function(_function)
+    {
+    }
+  };
+
+  inline void default_moved_from_handler(const moved_from_site &site)
+  {
+    fprintf(stderr, "FATAL: Outcome %s() read a moved-from object at %s:%u in %s\n", site.observer, site.file, site.line, site.function);  // NOLINT
+    abort();
+  }
+  inline std::atomic<moved_from_handler> &moved_from_handler_storage() noexcept
+  {
+    static std::atomic<moved_from_handler> v{&default_moved_from_handler};
+    return v;
+  }
+
+  // Kept out of line so the check adds only a test and a not taken branch to each observer
+#ifdef _MSC_VER
+  __declspec(noinline)
+#else
+  __attribute__((noinline, cold))
+#endif
+  inline void moved_from_access(const moved_from_site_here &here, const char *observer)
+  {
+    const moved_from_site site{here.file, here.line, here.function, observer};
+    moved_from_handler_storage().load(std::memory_order_acquire)(site);
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline moved_from_handler set_moved_from_handler(moved_from_handler h) noexcept
+{
+  return detail::moved_from_handler_storage().exchange((h != nullptr) ? h : &detail::default_moved_from_handler, std::memory_order_acq_rel);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#define OUTCOME_MOVED_FROM_SITE_PARAMETER ::OUTCOME_V2_NAMESPACE::detail::moved_from_site_here _site = {}
+#define OUTCOME_CHECK_MOVED_FROM(observer)                                                                                                                     \
+  if(::OUTCOME_V2_NAMESPACE::detail::status_of(this->_state).have_moved_from())                                                                                \
+  ::OUTCOME_V2_NAMESPACE::detail::moved_from_access(_site, observer)
+
+#endif
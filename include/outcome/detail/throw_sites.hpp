@@ -0,0 +1,93 @@
+/* Out of line throw sites shared by the wide observer policies
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_THROW_SITES_HPP
+#define OUTCOME_DETAIL_THROW_SITES_HPP
+
+#include "../bad_access.hpp"
+#include "trait_std_exception.hpp"
+
+#ifndef OUTCOME_COLD_THROW_SITE
+#if defined(__GNUC__) || defined(__clang__)
+#define OUTCOME_COLD_THROW_SITE __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define OUTCOME_COLD_THROW_SITE __declspec(noinline)
+#else
+#define OUTCOME_COLD_THROW_SITE
+#endif
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace policy
+{
+  /* The wide checks are instantiated for every result and outcome type, but the throws depend only on the error
+  type, if that. Keeping the throws in these functions leaves only a test and call in each observer, and every
+  instantiation of a given error type shares a single copy of the throw.
+  */
+  namespace detail
+  {
+    QUICKCPPLIB_NORETURN OUTCOME_COLD_THROW_SITE inline void throw_bad_result_access(const char *what)
+    {
+      OUTCOME_THROW_EXCEPTION(bad_result_access(what));  // NOLINT
+    }
+    QUICKCPPLIB_NORETURN OUTCOME_COLD_THROW_SITE inline void throw_bad_outcome_access(const char *what)
+    {
+      OUTCOME_THROW_EXCEPTION(bad_outcome_access(what));  // NOLINT
+    }
+    template <class EC> QUICKCPPLIB_NORETURN OUTCOME_COLD_THROW_SITE inline void throw_bad_result_access_with(EC &&error)
+    {
+      OUTCOME_THROW_EXCEPTION(bad_result_access_with<std::decay_t<EC>>(static_cast<EC &&>(error)));
+    }
+    // The customisation points are not required to be noreturn, so each is followed by the throw it previously fell through to
+    template <class Access, class EC> QUICKCPPLIB_NORETURN OUTCOME_COLD_THROW_SITE inline void throw_as_system_error_with_payload(EC &&error)
+    {
+      // ADL discovered
+      outcome_throw_as_system_error_with_payload(static_cast<EC &&>(error));
+      OUTCOME_THROW_EXCEPTION(Access("no value"));  // NOLINT
+    }
+    template <class Access, class EC> QUICKCPPLIB_NORETURN OUTCOME_COLD_THROW_SITE inline void rethrow_error(EC &&error)
+    {
+      // ADL
+      rethrow_exception(policy::exception_ptr(static_cast<EC &&>(error)));
+      OUTCOME_THROW_EXCEPTION(Access("no value"));  // NOLINT
+    }
+    template <bool has_error_payload> struct cold_rethrow_exception
+    {
+      template <class Exception> static void rethrow(Exception && /*unused*/) noexcept {}
+    };
+    template <> struct cold_rethrow_exception<true>
+    {
+      template <class Exception> OUTCOME_COLD_THROW_SITE static void rethrow(Exception &&excpt)
+      {
+        // ADL
+        rethrow_exception(policy::exception_ptr(static_cast<Exception &&>(excpt)));
+      }
+    };
+  }  // namespace detail
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -85,6 +85,12 @@ namespace trait
     static constexpr bool value = true;
   };
 
+  // std::exception_ptr is a reference counted pointer in every standard library, so does not care where it lives
+  template <> struct is_trivially_relocatable<std::exception_ptr>
+  {
+    static constexpr bool value = true;
+  };
+
 }  // namespace trait
 
 OUTCOME_V2_NAMESPACE_END
@@ -0,0 +1,184 @@
+/* USDT static tracepoints for result and outcome
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_USDT_HPP
+#define OUTCOME_DETAIL_USDT_HPP
+
+#include "failure_info.hpp"
+
+/* Probes are in provider `outcome`, and each takes three arguments:
+
+- `result_failure(int64 error value, char *type, char *error category name)`
+- `outcome_failure(int64 error value, char *type, char *error category name)`
+- `wide_value_check_failure(int64 error value, char *type, char *error category name)`
+- `coroutine_complete(void *promise, char *type, int64 has failed)`
+
+The error value is zero and the category name is null if there is no error, or the error type has no category. For example:
+
+    bpftrace -e 'usdt:./myprog:outcome:result_failure { printf("%s %d\n", str(arg1), arg0); }'
+
+The arguments are only computed whilst a tracer is attached, which tracers signal by incrementing the
+probe's semaphore. Reading the semaphore is the only cost of a probe when nothing is attached.
+*/
+
+#if defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__)) && (defined(__GNUC__) || defined(__clang__))
+#define OUTCOME_USDT_HAVE_SEMAPHORES 1
+// Emits the same version 3 .note.stapsdt entries as <sys/sdt.h> would, but with a semaphore for each probe
+// without requiring _SDT_HAS_SEMAPHORES of every other user of <sys/sdt.h>
+#define OUTCOME_USDT_PROBE3(name, a1, a2, a3)                                                                                                                  \
+  __asm__ __volatile__("990: nop\n"                                                                                                                            \
+                       ".pushsection .note.stapsdt,\"?\",\"note\"\n"                                                                                           \
+                       ".balign 4\n"                                                                                                                           \
+                       ".4byte 992f-991f,994f-993f,3\n"                                                                                                        \
+                       "991: .asciz \"stapsdt\"\n"                                                                                                             \
+                       "992: .balign 4\n"                                                                                                                      \
+                       "993: .8byte 990b\n"                                                                                                                    \
+                       ".8byte _.stapsdt.base\n"                                                                                                               \
+                       ".8byte outcome_" #name "_semaphore\n"                                                                                                  \
+                       ".asciz \"outcome\"\n"                                                                                                                  \
+                       ".asciz \"" #name "\"\n"                                                                                                                \
+                       ".asciz \"-8@%0 -8@%1 -8@%2\"\n"                                                                                                        \
+                       "994: .balign 4\n"                                                                                                                      \
+                       ".popsection\n"                                                                                                                         \
+                       ".ifndef _.stapsdt.base\n"                                                                                                              \
+                       ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"                                                                 \
+                       ".weak _.stapsdt.base\n"                                                                                                                \
+                       ".hidden _.stapsdt.base\n"                                                                                                              \
+                       "_.stapsdt.base: .space 1\n"                                                                                                            \
+                       ".size _.stapsdt.base,1\n"                                                                                                              \
+                       ".popsection\n"                                                                                                                         \
+                       ".endif\n" ::"nor"(OUTCOME_V2_NAMESPACE::detail::usdt_arg(a1)),                                                                         \
+                       "nor"(OUTCOME_V2_NAMESPACE::detail::usdt_arg(a2)), "nor"(OUTCOME_V2_NAMESPACE::detail::usdt_arg(a3)))
+#elif defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+// Semaphores are only emitted if the program defined _SDT_HAS_SEMAPHORES before including <sys/sdt.h>
+#if defined(_SDT_HAS_SEMAPHORES)
+#define OUTCOME_USDT_HAVE_SEMAPHORES 1
+#endif
+#include <sys/sdt.h>
+#define OUTCOME_USDT_PROBE3(name, a1, a2, a3) STAP_PROBE3(outcome, name, a1, a2, a3)
+#endif
+#endif
+#ifndef OUTCOME_USDT_PROBE3
+#error OUTCOME_ENABLE_USDT requires <sys/sdt.h>, or an x86-64 or AArch64 ELF target
+#endif
+
+#if defined(OUTCOME_USDT_HAVE_SEMAPHORES)
+// Weak so every translation unit may define them, and hidden so each shared object has its own for its own probes
+#define OUTCOME_USDT_SEMAPHORE(name) __attribute__((weak, visibility("hidden"), section(".probes"))) volatile unsigned short outcome_##name##_semaphore
+extern "C"
+{
+  OUTCOME_USDT_SEMAPHORE(result_failure);
+  OUTCOME_USDT_SEMAPHORE(outcome_failure);
+  OUTCOME_USDT_SEMAPHORE(wide_value_check_failure);
+  OUTCOME_USDT_SEMAPHORE(coroutine_complete);
+}
+#undef OUTCOME_USDT_SEMAPHORE
+#define OUTCOME_USDT_ENABLED(name) __builtin_expect(outcome_##name##_semaphore != 0, 0)
+#else
+#define OUTCOME_USDT_ENABLED(name) true
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define OUTCOME_USDT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(OUTCOME_USDT_IS_CONSTANT_EVALUATED) && defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9
+#define OUTCOME_USDT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#ifndef OUTCOME_USDT_IS_CONSTANT_EVALUATED
+#define OUTCOME_USDT_IS_CONSTANT_EVALUATED() false
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  template <class T, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, bool>::type = true> inline int64_t usdt_arg(T v) noexcept
+  {
+    return static_cast<int64_t>(v);
+  }
+  inline int64_t usdt_arg(const void *v) noexcept { return static_cast<int64_t>(reinterpret_cast<uintptr_t>(v)); }  // NOLINT
+
+  template <class C> inline auto usdt_has_failed(const C &c, priority<2> /*unused*/) noexcept -> decltype(static_cast<int64_t>(c.has_failure()))
+  {
+    return static_cast<int64_t>(c.has_failure());
+  }
+  template <class C> inline auto usdt_has_failed(const C &c, priority<1> /*unused*/) noexcept -> decltype(static_cast<int64_t>(c.has_error()))
+  {
+    return static_cast<int64_t>(c.has_error());
+  }
+  template <class C> inline int64_t usdt_has_failed(const C & /*unused*/, priority<0> /*unused*/) noexcept { return 0; }
+
+  // These are deliberately not constexpr, callers must check they are not being constant evaluated.
+  // The error is null if there is none, e.g. an outcome holding only an exception
+  template <class T, class E> inline void usdt_result_failure(const E *e) noexcept
+  {
+    if(OUTCOME_USDT_ENABLED(result_failure))
+    {
+      const auto info = (e != nullptr) ? extract_error_info(*e, priority<2>()) : error_info{nullptr, 0};
+      const char *type = type_signature<T>();
+      OUTCOME_USDT_PROBE3(result_failure, info.value, type, info.domain);
+    }
+  }
+  template <class T, class E> inline void usdt_outcome_failure(const E *e) noexcept
+  {
+    if(OUTCOME_USDT_ENABLED(outcome_failure))
+    {
+      const auto info = (e != nullptr) ? extract_error_info(*e, priority<2>()) : error_info{nullptr, 0};
+      const char *type = type_signature<T>();
+      OUTCOME_USDT_PROBE3(outcome_failure, info.value, type, info.domain);
+    }
+  }
+  template <class T, class E> inline void usdt_wide_value_check_failure(const E *e) noexcept
+  {
+    if(OUTCOME_USDT_ENABLED(wide_value_check_failure))
+    {
+      const auto info = (e != nullptr) ? extract_error_info(*e, priority<2>()) : error_info{nullptr, 0};
+      const char *type = type_signature<T>();
+      OUTCOME_USDT_PROBE3(wide_value_check_failure, info.value, type, info.domain);
+    }
+  }
+  template <class T> inline void usdt_coroutine_complete(const void *promise, const T &v) noexcept
+  {
+    if(OUTCOME_USDT_ENABLED(coroutine_complete))
+    {
+      const int64_t failed = usdt_has_failed(v, priority<2>());
+      const char *type = type_signature<T>();
+      OUTCOME_USDT_PROBE3(coroutine_complete, promise, type, failed);
+    }
+  }
+  inline void usdt_coroutine_complete(const void *promise) noexcept
+  {
+    if(OUTCOME_USDT_ENABLED(coroutine_complete))
+    {
+      const int64_t failed = 0;
+      const char *type = type_signature<void>();
+      OUTCOME_USDT_PROBE3(coroutine_complete, promise, type, failed);
+    }
+  }
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+
+#endif
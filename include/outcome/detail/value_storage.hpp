@@ -26,11 +26,48 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_VALUE_STORAGE_HPP
 
 #include "../config.hpp"
+#include "../success_failure.hpp"
+#include "../trait.hpp"
+
+#include <cstdio>   // for fprintf
+#include <cstdlib>  // for abort
+#include <cstring>  // for memcpy
+#include <memory>   // for construct_at
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
+template <class T> class packed_errno;  // sysresult.hpp
+
 namespace detail
 {
+  // Constructs a packed_errno from a syscall's return word as is
+  struct packed_errno_raw_tag
+  {
+  };
+  // Called if a packed_errno word would read as the wrong one of value or error. It is not constexpr, so doing so in
+  // constant evaluation fails to compile, and at runtime it aborts whether or not asserts are enabled.
+  inline void packed_errno_misread() noexcept
+  {
+    fprintf(stderr, "FATAL: Outcome sysresult was given a word which would read as the wrong one of value or error\n");  // NOLINT
+    abort();
+  }
+
+  /* Placement new cannot be used in constant evaluation, but from C++ 20 std::construct_at can, so
+  everything which constructs into storage does so through here.
+  */
+  template <class T, class... Args>
+#if __cplusplus >= 202000L || _HAS_CXX20
+  constexpr
+#endif
+  inline T *placement_new(T *p, Args &&...args) noexcept(detail::is_nothrow_constructible<T, Args...>)
+  {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    return std::construct_at(p, static_cast<Args &&>(args)...);
+#else
+    return new(p) T(static_cast<Args &&>(args)...);
+#endif
+  }
+
   // Helpers for move assigning to empty storage
   template <class T, bool isCopyOrMoveConstructible = std::is_copy_constructible<T>::value || std::is_move_constructible<T>::value,
             bool isDefaultConstructibleAndCopyOrMoveAssignable =
@@ -39,28 +76,43 @@ namespace detail
   // Prefer to use move or copy construction
   template <class T> struct move_assign_to_empty<T, true, false>
   {
-    move_assign_to_empty(T *dest, T *o) noexcept(std::is_nothrow_move_constructible<T>::value) { new(dest) T(static_cast<T &&>(*o)); }
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
+    move_assign_to_empty(T *dest, T *o) noexcept(std::is_nothrow_move_constructible<T>::value) { placement_new(dest, static_cast<T &&>(*o)); }
   };
   template <class T> struct move_assign_to_empty<T, true, true>
   {
-    move_assign_to_empty(T *dest, T *o) noexcept(std::is_nothrow_move_constructible<T>::value) { new(dest) T(static_cast<T &&>(*o)); }
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
+    move_assign_to_empty(T *dest, T *o) noexcept(std::is_nothrow_move_constructible<T>::value) { placement_new(dest, static_cast<T &&>(*o)); }
   };
   // But fall back on default construction and move assign if necessary
   template <class T> struct move_assign_to_empty<T, false, true>
   {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
     move_assign_to_empty(T *dest, T *o) noexcept(std::is_nothrow_default_constructible<T>::value && std::is_nothrow_move_assignable<T>::value)
     {
-      new(dest) T;
+      placement_new(dest);
       *dest = static_cast<T &&>(*o);
     }
   };
   // Void does nothing
   template <> struct move_assign_to_empty<void, false, false>
   {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
     move_assign_to_empty(void *, void *) noexcept { /* nothing to assign */ }
   };
   template <> struct move_assign_to_empty<const void, false, false>
   {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
     move_assign_to_empty(const void *, const void *) noexcept { /* nothing to assign */ }
   };
   // Helpers for copy assigning to empty storage
@@ -70,28 +122,43 @@ namespace detail
   // Prefer to use copy construction
   template <class T> struct copy_assign_to_empty<T, true, false>
   {
-    copy_assign_to_empty(T *dest, const T *o) noexcept(std::is_nothrow_copy_constructible<T>::value) { new(dest) T(*o); }
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
+    copy_assign_to_empty(T *dest, const T *o) noexcept(std::is_nothrow_copy_constructible<T>::value) { placement_new(dest, *o); }
   };
   template <class T> struct copy_assign_to_empty<T, true, true>
   {
-    copy_assign_to_empty(T *dest, const T *o) noexcept(std::is_nothrow_copy_constructible<T>::value) { new(dest) T(*o); }
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
+    copy_assign_to_empty(T *dest, const T *o) noexcept(std::is_nothrow_copy_constructible<T>::value) { placement_new(dest, *o); }
   };
   // But fall back on default construction and copy assign if necessary
   template <class T> struct copy_assign_to_empty<T, false, true>
   {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
     copy_assign_to_empty(T *dest, const T *o) noexcept(std::is_nothrow_default_constructible<T>::value && std::is_nothrow_copy_assignable<T>::value)
     {
-      new(dest) T;
+      placement_new(dest);
       *dest = *o;
     }
   };
   // Void does nothing
   template <> struct copy_assign_to_empty<void, false, false>
   {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
     copy_assign_to_empty(void *, void *) noexcept { /* nothing to assign */ }
   };
   template <> struct copy_assign_to_empty<const void, false, false>
   {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
     copy_assign_to_empty(const void *, const void *) noexcept { /* nothing to assign */ }
   };
 
@@ -109,14 +176,34 @@ namespace detail
     template <class F> constexpr strong_placement_impl(bool &allgood, T *a, T *b, F &&f)
     {
       allgood = true;
-      new(a) T(static_cast<T &&>(*b));
+      placement_new(a, static_cast<T &&>(*b));
       b->~T();
       f();
     }
   };
+  // Before C++ 20 nothing non-trivial can be constant evaluated, so there is nothing to detect
+  constexpr inline bool is_constant_evaluated() noexcept
+  {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+  }
+  // Exchanges the bytes of two objects, which is a swap only if all they hold is trivially relocatable
+  template <class T> inline void relocating_swap(T &a, T &b) noexcept
+  {
+    alignas(T) unsigned char temp[sizeof(T)];
+    memcpy(temp, static_cast<void *>(OUTCOME_ADDRESS_OF(a)), sizeof(T));
+    memcpy(static_cast<void *>(OUTCOME_ADDRESS_OF(a)), static_cast<void *>(OUTCOME_ADDRESS_OF(b)), sizeof(T));
+    memcpy(static_cast<void *>(OUTCOME_ADDRESS_OF(b)), temp, sizeof(T));
+  }
 #ifdef __cpp_exceptions
   template <class T> struct strong_swap_impl<T, false>
   {
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
     strong_swap_impl(bool &allgood, T &a, T &b)
     {
       allgood = true;
@@ -167,9 +254,13 @@ namespace detail
   };
   template <class T> struct strong_placement_impl<T, false>
   {
-    template <class F> strong_placement_impl(bool &allgood, T *a, T *b, F &&f)
+    template <class F>
+#if __cplusplus >= 202000L || _HAS_CXX20
+    constexpr
+#endif
+    strong_placement_impl(bool &allgood, T *a, T *b, F &&f)
     {
-      new(a) T(static_cast<T &&>(*b));
+      placement_new(a, static_cast<T &&>(*b));
       try
       {
         b->~T();
@@ -182,7 +273,7 @@ namespace detail
         {
           try
           {
-            new(b) T(static_cast<T &&>(*a));
+            placement_new(b, static_cast<T &&>(*a));
             // fall through as all good
           }
           catch(...)
@@ -317,50 +408,62 @@ namespace detail
     constexpr status_bitfield_type &operator=(status_bitfield_type &&) = default;
     //~status_bitfield_type() = default;  // Do NOT uncomment this, it breaks older clangs!
 
-    constexpr bool have_value() const noexcept { return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_value)) != 0; }
-    constexpr bool have_error() const noexcept { return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_error)) != 0; }
-    constexpr bool have_exception() const noexcept { return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_exception)) != 0; }
-    constexpr bool have_lost_consistency() const noexcept
+    OUTCOME_OBSERVER_INLINE constexpr bool have_value() const noexcept
+    {
+      return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_value)) != 0;
+    }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error() const noexcept
+    {
+      return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_error)) != 0;
+    }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_exception() const noexcept
+    {
+      return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_exception)) != 0;
+    }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_lost_consistency() const noexcept
     {
       return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_lost_consistency)) != 0;
     }
-    constexpr bool have_error_is_errno() const noexcept
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error_is_errno() const noexcept
     {
       return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_error_is_errno)) != 0;
     }
-    constexpr bool have_moved_from() const noexcept { return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_moved_from)) != 0; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_moved_from() const noexcept
+    {
+      return (static_cast<uint16_t>(status_value) & static_cast<uint16_t>(status::have_moved_from)) != 0;
+    }
 
-    constexpr status_bitfield_type &set_have_value(bool v) noexcept
+    OUTCOME_OBSERVER_INLINE constexpr status_bitfield_type &set_have_value(bool v) noexcept
     {
       status_value = static_cast<status>(v ? (static_cast<uint16_t>(status_value) | static_cast<uint16_t>(status::have_value)) :
                                              (static_cast<uint16_t>(status_value) & ~static_cast<uint16_t>(status::have_value)));
       return *this;
     }
-    constexpr status_bitfield_type &set_have_error(bool v) noexcept
+    OUTCOME_OBSERVER_INLINE constexpr status_bitfield_type &set_have_error(bool v) noexcept
     {
       status_value = static_cast<status>(v ? (static_cast<uint16_t>(status_value) | static_cast<uint16_t>(status::have_error)) :
                                              (static_cast<uint16_t>(status_value) & ~static_cast<uint16_t>(status::have_error)));
       return *this;
     }
-    constexpr status_bitfield_type &set_have_exception(bool v) noexcept
+    OUTCOME_OBSERVER_INLINE constexpr status_bitfield_type &set_have_exception(bool v) noexcept
     {
       status_value = static_cast<status>(v ? (static_cast<uint16_t>(status_value) | static_cast<uint16_t>(status::have_exception)) :
                                              (static_cast<uint16_t>(status_value) & ~static_cast<uint16_t>(status::have_exception)));
       return *this;
     }
-    constexpr status_bitfield_type &set_have_error_is_errno(bool v) noexcept
+    OUTCOME_OBSERVER_INLINE constexpr status_bitfield_type &set_have_error_is_errno(bool v) noexcept
     {
       status_value = static_cast<status>(v ? (static_cast<uint16_t>(status_value) | static_cast<uint16_t>(status::have_error_is_errno)) :
                                              (static_cast<uint16_t>(status_value) & ~static_cast<uint16_t>(status::have_error_is_errno)));
       return *this;
     }
-    constexpr status_bitfield_type &set_have_lost_consistency(bool v) noexcept
+    OUTCOME_OBSERVER_INLINE constexpr status_bitfield_type &set_have_lost_consistency(bool v) noexcept
     {
       status_value = static_cast<status>(v ? (static_cast<uint16_t>(status_value) | static_cast<uint16_t>(status::have_lost_consistency)) :
                                              (static_cast<uint16_t>(status_value) & ~static_cast<uint16_t>(status::have_lost_consistency)));
       return *this;
     }
-    constexpr status_bitfield_type &set_have_moved_from(bool v) noexcept
+    OUTCOME_OBSERVER_INLINE constexpr status_bitfield_type &set_have_moved_from(bool v) noexcept
     {
       status_value = static_cast<status>(v ? (static_cast<uint16_t>(status_value) | static_cast<uint16_t>(status::have_moved_from)) :
                                              (static_cast<uint16_t>(status_value) & ~static_cast<uint16_t>(status::have_moved_from)));
@@ -383,6 +486,71 @@ namespace detail
 
   template <class State> constexpr inline void _set_error_is_errno(State & /*unused*/) {}
 
+  /* A value type of `T &` is stored as a pointer to T, which is trivial, and so the storage selected is
+  whichever would be for a pointer. It converts to `T &` so the observers return the reference, and
+  assigning it rebinds the pointer rather than assigning through it.
+  */
+  template <class T> struct reference_storage
+  {
+    static_assert(std::is_object<T>::value, "basic_result<T &> requires T to be an object type");
+
+    T *_ptr;
+
+    reference_storage() = default;
+    constexpr reference_storage(T &v) noexcept  // NOLINT
+        : _ptr(OUTCOME_ADDRESS_OF(v))
+    {
+    }
+    // Do not bind to temporaries, they would dangle
+    reference_storage(T &&) = delete;
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_same<U, T>::value && std::is_convertible<U *, T *>::value))
+    constexpr reference_storage(const reference_storage<U> &o) noexcept  // NOLINT
+        : _ptr(o._ptr)
+    {
+    }
+
+    OUTCOME_OBSERVER_INLINE constexpr operator T &() const noexcept { return *_ptr; }  // NOLINT
+  };
+  template <class T> struct is_reference_storage : std::false_type
+  {
+  };
+  template <class T> struct is_reference_storage<reference_storage<T>> : std::true_type
+  {
+  };
+  // Compare what is referred to, as comparing the results of T would
+  template <class T, class U>
+  constexpr inline bool operator==(const reference_storage<T> &a, const reference_storage<U> &b) noexcept(noexcept(std::declval<T &>() == std::declval<U &>()))
+  {
+    return *a._ptr == *b._ptr;
+  }
+  OUTCOME_TEMPLATE(class T, class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!is_reference_storage<U>::value), OUTCOME_TEXPR(std::declval<T &>() == std::declval<const U &>()))
+  constexpr inline bool operator==(const reference_storage<T> &a, const U &b) noexcept(noexcept(std::declval<T &>() == b))
+  {
+    return *a._ptr == b;
+  }
+  template <class T, class U>
+  constexpr inline bool operator!=(const reference_storage<T> &a, const reference_storage<U> &b) noexcept(noexcept(std::declval<T &>() != std::declval<U &>()))
+  {
+    return *a._ptr != *b._ptr;
+  }
+  OUTCOME_TEMPLATE(class T, class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!is_reference_storage<U>::value), OUTCOME_TEXPR(std::declval<T &>() != std::declval<const U &>()))
+  constexpr inline bool operator!=(const reference_storage<T> &a, const U &b) noexcept(noexcept(std::declval<T &>() != b))
+  {
+    return *a._ptr != b;
+  }
+
+  template <class T> struct value_storage_type_of
+  {
+    using type = T;
+  };
+  template <class T> struct value_storage_type_of<T &>
+  {
+    using type = reference_storage<T>;
+  };
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4127)  // conditional expression is constant
@@ -470,11 +638,11 @@ namespace detail
     constexpr explicit value_storage_trivial(const value_storage_trivial<U, V> &o,
                                              nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept(detail::is_nothrow_constructible<_value_type_, U> &&
                                                                                                           detail::is_nothrow_constructible<_error_type_, V>)
-        : value_storage_trivial(o._status.have_value() ?
-                                value_storage_trivial(in_place_type<value_type>, o._value) :
-                                (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, o._error) : value_storage_trivial()))  // NOLINT
+        : value_storage_trivial(status_of(o).have_value() ?
+                                value_storage_trivial(in_place_type<value_type>, value_of(o)) :
+                                (status_of(o).have_error() ? value_storage_trivial(in_place_type<error_type>, o._error) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = status_of(o);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
@@ -482,11 +650,11 @@ namespace detail
                                              nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept(detail::is_nothrow_constructible<_value_type_, U> &&
                                                                                                           detail::is_nothrow_constructible<_error_type_, V>)
         : value_storage_trivial(
-          o._status.have_value() ?
-          value_storage_trivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
-          (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_trivial()))  // NOLINT
+          status_of(o).have_value() ?
+          value_storage_trivial(in_place_type<value_type>, static_cast<U &&>(value_of(o))) :
+          (status_of(o).have_error() ? value_storage_trivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = status_of(o);
     }
 
     struct void_value_converting_constructor_tag
@@ -499,58 +667,489 @@ namespace detail
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_value_converting_constructor<V>))
     constexpr explicit value_storage_trivial(const value_storage_trivial<void, V> &o, void_value_converting_constructor_tag /*unused*/ = {}) noexcept(
     std::is_nothrow_default_constructible<_value_type_>::value && detail::is_nothrow_constructible<_error_type_, V>)
-        : value_storage_trivial(o._status.have_value() ?
+        : value_storage_trivial(status_of(o).have_value() ?
                                 value_storage_trivial(in_place_type<value_type>) :
-                                (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, o._error) : value_storage_trivial()))  // NOLINT
+                                (status_of(o).have_error() ? value_storage_trivial(in_place_type<error_type>, o._error) : value_storage_trivial()))  // NOLINT
     {
-      _status = o._status;
+      _status = status_of(o);
     }
     OUTCOME_TEMPLATE(class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_value_converting_constructor<V>))
     constexpr explicit value_storage_trivial(value_storage_trivial<void, V> &&o, void_value_converting_constructor_tag /*unused*/ = {}) noexcept(
     std::is_nothrow_default_constructible<_value_type_>::value && detail::is_nothrow_constructible<_error_type_, V>)
         : value_storage_trivial(
-          o._status.have_value() ?
+          status_of(o).have_value() ?
           value_storage_trivial(in_place_type<value_type>) :
-          (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_trivial()))  // NOLINT
+          (status_of(o).have_error() ? value_storage_trivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_trivial()))  // NOLINT
+    {
+      _status = status_of(o);
+    }
+
+    struct void_error_converting_constructor_tag
+    {
+    };
+    template <class U>
+    static constexpr bool enable_void_error_converting_constructor =
+    std::is_default_constructible<error_type>::value && detail::is_constructible<value_type, U>;
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_error_converting_constructor<U>))
+    constexpr explicit value_storage_trivial(const value_storage_trivial<U, void> &o, void_error_converting_constructor_tag /*unused*/ = {}) noexcept(
+    detail::is_nothrow_constructible<_value_type_, U> && std::is_nothrow_default_constructible<_error_type_>::value)
+        : value_storage_trivial(status_of(o).have_value() ?
+                                value_storage_trivial(in_place_type<value_type>, value_of(o)) :
+                                (status_of(o).have_error() ? value_storage_trivial(in_place_type<error_type>) : value_storage_trivial()))  // NOLINT
+    {
+      _status = status_of(o);
+    }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_error_converting_constructor<U>))
+    constexpr explicit value_storage_trivial(value_storage_trivial<U, void> &&o, void_error_converting_constructor_tag /*unused*/ = {}) noexcept(
+    detail::is_nothrow_constructible<_value_type_, U> && std::is_nothrow_default_constructible<_error_type_>::value)
+        : value_storage_trivial(status_of(o).have_value() ?
+                                value_storage_trivial(in_place_type<value_type>, static_cast<U &&>(value_of(o))) :
+                                (status_of(o).have_error() ? value_storage_trivial(in_place_type<error_type>) : value_storage_trivial()))  // NOLINT
+    {
+      _status = status_of(o);
+    }
+    constexpr void swap(value_storage_trivial &o) noexcept
+    {
+      // storage is trivial, so just use assignment
+      auto temp = static_cast<value_storage_trivial &&>(*this);
+      *this = static_cast<value_storage_trivial &&>(o);
+      o = static_cast<value_storage_trivial &&>(temp);
+    }
+  };
+
+  /* The status and the value of a storage. Storages without a status word, or which keep their value
+  elsewhere, overload these, so that what they compute them from is read through whichever of their
+  members is active.
+  */
+  template <class State> OUTCOME_OBSERVER_INLINE constexpr auto status_of(const State &s) noexcept -> decltype((s._status)) { return s._status; }
+  template <class State> OUTCOME_OBSERVER_INLINE constexpr auto value_of(State &s) noexcept -> decltype((s._value)) { return s._value; }
+
+  // The spare storage of a status with none, which reads as zero, and discards writes
+  struct no_spare_storage
+  {
+    constexpr operator uint16_t() const noexcept { return 0; }  // NOLINT
+    constexpr const no_spare_storage &operator=(uint16_t /*unused*/) const noexcept { return *this; }
+  };
+
+  /* The `_status` of a storage without a status word, whose status is computed by `status_of()`. There is
+  nothing to set, so setting does nothing, and there is no spare storage.
+  */
+  struct no_status_storage
+  {
+    no_spare_storage spare_storage_value;  // hooks::spare_storage()
+
+    OUTCOME_OBSERVER_INLINE constexpr const no_status_storage &set_have_value(bool /*unused*/) const noexcept { return *this; }
+    OUTCOME_OBSERVER_INLINE constexpr const no_status_storage &set_have_error(bool /*unused*/) const noexcept { return *this; }
+    OUTCOME_OBSERVER_INLINE constexpr const no_status_storage &set_have_exception(bool /*unused*/) const noexcept { return *this; }
+    OUTCOME_OBSERVER_INLINE constexpr const no_status_storage &set_have_error_is_errno(bool /*unused*/) const noexcept { return *this; }
+    OUTCOME_OBSERVER_INLINE constexpr const no_status_storage &set_have_lost_consistency(bool /*unused*/) const noexcept { return *this; }
+    OUTCOME_OBSERVER_INLINE constexpr const no_status_storage &set_have_moved_from(bool /*unused*/) const noexcept { return *this; }
+  };
+
+  /* The status of a `value_storage_trivial<T, packed_errno<T>>`, computed from its one machine word. As
+  with the kernel's syscall convention, a negative word is an errno, and anything else is a value.
+  */
+  struct packed_errno_status
+  {
+    bool _negative;
+
+    OUTCOME_OBSERVER_INLINE constexpr bool have_value() const noexcept { return !_negative; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error() const noexcept { return _negative; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_exception() const noexcept { return false; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_lost_consistency() const noexcept { return false; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error_is_errno() const noexcept { return _negative; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_moved_from() const noexcept { return false; }
+
+    // For the converting constructors of other storage
+    constexpr operator status_bitfield_type() const noexcept { return _negative ? status::have_error_error_is_errno : status::have_value; }  // NOLINT
+  };
+
+  /* Used for `sysresult<T>`, the value, the error and the status are all one machine word, so the
+  success path is a single register. The word is always kept in the `packed_errno<T>`, whose word is the
+  value when it is not negative, so that is always the active member, and `value_of()` and `status_of()`
+  read the value and the sign from it.
+  */
+  template <class T> struct value_storage_trivial<T, packed_errno<T>>
+  {
+    static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "sysresult<T> requires T to be a signed integral type");
+
+    using value_type = T;
+    using error_type = packed_errno<T>;
+
+    using _value_type = value_type;
+    using _error_type = error_type;
+    using _value_type_ = value_type;
+    using _error_type_ = error_type;
+
+    _error_type_ _error;
+    static constexpr no_status_storage _status{};
+
+    constexpr value_storage_trivial() noexcept
+        : _error(packed_errno_raw_tag(), _value_type_())
+    {
+    }
+    value_storage_trivial(const value_storage_trivial &) = default;             // NOLINT
+    value_storage_trivial(value_storage_trivial &&) = default;                  // NOLINT
+    value_storage_trivial &operator=(const value_storage_trivial &) = default;  // NOLINT
+    value_storage_trivial &operator=(value_storage_trivial &&) = default;       // NOLINT
+    ~value_storage_trivial() = default;
+    template <class... Args>
+    constexpr explicit value_storage_trivial(in_place_type_t<_value_type> /*unused*/,
+                                             Args &&...args) noexcept(detail::is_nothrow_constructible<_value_type_, Args...>)
+        : _error(packed_errno_raw_tag(), _value_type_(static_cast<Args &&>(args)...))
+    {
+      // A negative value would read as an error
+      if(_error._word < 0)
+      {
+        packed_errno_misread();
+      }
+    }
+    template <class... Args>
+    constexpr explicit value_storage_trivial(in_place_type_t<_error_type> /*unused*/,
+                                             Args &&...args) noexcept(detail::is_nothrow_constructible<_error_type_, Args...>)
+        : _error(static_cast<Args &&>(args)...)
+    {
+    }
+
+    struct nonvoid_converting_constructor_tag
+    {
+    };
+    template <class U>
+    static constexpr bool enable_nonvoid_converting_constructor =
+    !std::is_same<std::decay_t<U>, value_type>::value && detail::is_constructible<value_type, U>;
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U>))
+    constexpr explicit value_storage_trivial(const value_storage_trivial<U, packed_errno<U>> &o, nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept
+        : _error(packed_errno_raw_tag(), static_cast<_value_type_>(o._error._word))
+    {
+    }
+    constexpr void swap(value_storage_trivial &o) noexcept
+    {
+      // storage is trivial, so just use assignment
+      auto temp = static_cast<value_storage_trivial &&>(*this);
+      *this = static_cast<value_storage_trivial &&>(o);
+      o = static_cast<value_storage_trivial &&>(temp);
+    }
+
+    OUTCOME_OBSERVER_INLINE constexpr _value_type_ &_word() noexcept { return _error._word; }
+    OUTCOME_OBSERVER_INLINE constexpr const _value_type_ &_word() const noexcept { return _error._word; }
+  };
+#ifndef __cpp_inline_variables
+  template <class T> constexpr no_status_storage value_storage_trivial<T, packed_errno<T>>::_status;
+#endif
+  template <class T> OUTCOME_OBSERVER_INLINE constexpr packed_errno_status status_of(const value_storage_trivial<T, packed_errno<T>> &s) noexcept
+  {
+    return packed_errno_status{s._word() < 0};
+  }
+  template <class T> OUTCOME_OBSERVER_INLINE constexpr T &value_of(value_storage_trivial<T, packed_errno<T>> &s) noexcept { return s._word(); }
+  template <class T> OUTCOME_OBSERVER_INLINE constexpr const T &value_of(const value_storage_trivial<T, packed_errno<T>> &s) noexcept { return s._word(); }
+
+  // Whether the observers hand out the value only as const, as writing it would change the status too
+  template <class State> struct is_value_read_only : std::false_type
+  {
+  };
+  template <class T> struct is_value_read_only<value_storage_trivial<T, packed_errno<T>>> : std::true_type
+  {
+  };
+
+  /* The status of a `value_storage_trivial<reference_storage<T>, void>`, computed from its pointer. As
+  there is no error to store, a null pointer is the error.
+  */
+  struct reference_niche_status
+  {
+    bool _null;
+
+    OUTCOME_OBSERVER_INLINE constexpr bool have_value() const noexcept { return !_null; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error() const noexcept { return _null; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_exception() const noexcept { return false; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_lost_consistency() const noexcept { return false; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error_is_errno() const noexcept { return false; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_moved_from() const noexcept { return false; }
+
+    // For the converting constructors of other storage
+    constexpr operator status_bitfield_type() const noexcept { return _null ? status::have_error : status::have_value; }  // NOLINT
+  };
+
+  /* Used for `basic_result<T &, void>`, which is a single pointer, null if there is no value, so testing
+  for a value tests the pointer. The pointer is always the active member, and `status_of()` reads it.
+  */
+  template <class T> struct value_storage_trivial<reference_storage<T>, void>
+  {
+    using value_type = reference_storage<T>;
+    using error_type = void;
+
+    using _value_type = value_type;
+    using _error_type = error_type;
+    using _value_type_ = value_type;
+    using _error_type_ = devoid<error_type>;
+
+    union
+    {
+      _value_type_ _value;
+      _error_type_ _error;
+    };
+    // Whether there is a value or an error is set by writing the pointer or not
+    static constexpr no_status_storage _status{};
+
+    constexpr value_storage_trivial() noexcept
+        : _value()
+    {
+    }
+    value_storage_trivial(const value_storage_trivial &) = default;             // NOLINT
+    value_storage_trivial(value_storage_trivial &&) = default;                  // NOLINT
+    value_storage_trivial &operator=(const value_storage_trivial &) = default;  // NOLINT
+    value_storage_trivial &operator=(value_storage_trivial &&) = default;       // NOLINT
+    ~value_storage_trivial() = default;
+    template <class... Args>
+    constexpr explicit value_storage_trivial(in_place_type_t<_value_type> /*unused*/,
+                                             Args &&...args) noexcept(detail::is_nothrow_constructible<_value_type_, Args...>)
+        : _value(static_cast<Args &&>(args)...)
+    {
+    }
+    constexpr explicit value_storage_trivial(in_place_type_t<_error_type> /*unused*/) noexcept
+        : _value()
+    {
+    }
+
+    struct nonvoid_converting_constructor_tag
+    {
+    };
+    template <class U>
+    static constexpr bool enable_nonvoid_converting_constructor = !std::is_same<U, T>::value && std::is_convertible<U *, T *>::value;
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U>))
+    constexpr explicit value_storage_trivial(const value_storage_trivial<reference_storage<U>, void> &o,
+                                             nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept
+        : _value(o._value)
+    {
+    }
+    constexpr void swap(value_storage_trivial &o) noexcept
+    {
+      // storage is trivial, so just use assignment
+      auto temp = static_cast<value_storage_trivial &&>(*this);
+      *this = static_cast<value_storage_trivial &&>(o);
+      o = static_cast<value_storage_trivial &&>(temp);
+    }
+  };
+#ifndef __cpp_inline_variables
+  template <class T> constexpr no_status_storage value_storage_trivial<reference_storage<T>, void>::_status;
+#endif
+  template <class T> OUTCOME_OBSERVER_INLINE constexpr reference_niche_status status_of(const value_storage_trivial<reference_storage<T>, void> &s) noexcept
+  {
+    return reference_niche_status{s._value._ptr == nullptr};
+  }
+
+  /* The status of a `value_storage_compact`, which keeps the bits of `status_bitfield_type` in a single
+  byte, as they all fit, and has no spare storage. It is a template only so its spare storage can be
+  defined in this header.
+  */
+  template <class T, class E> struct compact_status_type
+  {
+    uint8_t status_value{0};
+
+    static constexpr no_spare_storage spare_storage_value{};  // hooks::spare_storage()
+
+    constexpr compact_status_type() = default;
+    constexpr compact_status_type(status v) noexcept  // NOLINT
+        : status_value(static_cast<uint8_t>(v))
+    {
+    }
+    // Any spare storage is lost
+    constexpr explicit compact_status_type(status_bitfield_type v) noexcept
+        : status_value(static_cast<uint8_t>(v.status_value))
+    {
+    }
+
+    OUTCOME_OBSERVER_INLINE constexpr bool have_value() const noexcept { return (status_value & static_cast<uint8_t>(status::have_value)) != 0; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error() const noexcept { return (status_value & static_cast<uint8_t>(status::have_error)) != 0; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_exception() const noexcept { return (status_value & static_cast<uint8_t>(status::have_exception)) != 0; }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_lost_consistency() const noexcept
+    {
+      return (status_value & static_cast<uint8_t>(status::have_lost_consistency)) != 0;
+    }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_error_is_errno() const noexcept
+    {
+      return (status_value & static_cast<uint8_t>(status::have_error_is_errno)) != 0;
+    }
+    OUTCOME_OBSERVER_INLINE constexpr bool have_moved_from() const noexcept { return (status_value & static_cast<uint8_t>(status::have_moved_from)) != 0; }
+
+    OUTCOME_OBSERVER_INLINE constexpr compact_status_type &set_have_value(bool v) noexcept { return _set(status::have_value, v); }
+    OUTCOME_OBSERVER_INLINE constexpr compact_status_type &set_have_error(bool v) noexcept { return _set(status::have_error, v); }
+    OUTCOME_OBSERVER_INLINE constexpr compact_status_type &set_have_exception(bool v) noexcept { return _set(status::have_exception, v); }
+    OUTCOME_OBSERVER_INLINE constexpr compact_status_type &set_have_error_is_errno(bool v) noexcept { return _set(status::have_error_is_errno, v); }
+    OUTCOME_OBSERVER_INLINE constexpr compact_status_type &set_have_lost_consistency(bool v) noexcept { return _set(status::have_lost_consistency, v); }
+    OUTCOME_OBSERVER_INLINE constexpr compact_status_type &set_have_moved_from(bool v) noexcept { return _set(status::have_moved_from, v); }
+
+    // For the converting constructors of other storage
+    constexpr operator status_bitfield_type() const noexcept { return static_cast<status>(status_value); }  // NOLINT
+
+  private:
+    OUTCOME_OBSERVER_INLINE constexpr compact_status_type &_set(status bit, bool v) noexcept
+    {
+      status_value = static_cast<uint8_t>(v ? (status_value | static_cast<uint8_t>(bit)) : (status_value & ~static_cast<uint8_t>(bit)));
+      return *this;
+    }
+  };
+#ifndef __cpp_inline_variables
+  template <class T, class E> constexpr no_spare_storage compact_status_type<T, E>::spare_storage_value;
+#endif
+
+  // Whether a storage of type T has the status of a value storage, i.e. is the state of some basic_result
+  template <class T> struct is_value_storage
+  {
+    template <class U> static std::true_type _test(decltype(status_of(std::declval<const U &>()).have_value()) * /*unused*/);
+    template <class U> static std::false_type _test(...);
+    static constexpr bool value = decltype(_test<T>(nullptr))::value;
+  };
+  // Whether the value or error of some other storage, of type U, can construct one of type T
+  template <class T, class U> struct is_storage_member_constructible
+  {
+    static constexpr bool value = detail::is_constructible<devoid<T>, devoid<U>>;
+  };
+  template <class T> struct is_storage_member_constructible<T, void>
+  {
+    static constexpr bool value = std::is_default_constructible<devoid<T>>::value;
+  };
+  // Whether Src is the state of a basic_result whose value and error can construct those of ours
+  template <class T, class E, class Src, bool = is_value_storage<Src>::value> struct is_value_storage_convertible
+  {
+    static constexpr bool value = false;
+  };
+  template <class T, class E, class Src> struct is_value_storage_convertible<T, E, Src, true>
+  {
+    static constexpr bool value =
+    is_storage_member_constructible<T, typename Src::value_type>::value && is_storage_member_constructible<E, typename Src::error_type>::value;
+  };
+
+  /* Used instead of `value_storage_trivial` if the no-value policy is a `policy::compact_status`. Both
+  T and E are trivial, and without spare storage the status is one byte rather than four, so
+  `basic_result<bool, uint8_t>` is two bytes rather than six.
+  */
+  template <class T, class E> struct value_storage_compact
+  {
+    using value_type = T;
+    using error_type = E;
+
+    // Disable in place construction if they are the same type
+    struct disable_in_place_value_type
+    {
+    };
+    struct disable_in_place_error_type
+    {
+    };
+    using _value_type = std::conditional_t<std::is_same<value_type, error_type>::value, disable_in_place_value_type, value_type>;
+    using _error_type = std::conditional_t<std::is_same<value_type, error_type>::value, disable_in_place_error_type, error_type>;
+    using _value_type_ = devoid<value_type>;
+    using _error_type_ = devoid<error_type>;
+
+    union
+    {
+      empty_type _empty;
+      _value_type_ _value;
+      _error_type_ _error;
+    };
+    compact_status_type<T, E> _status;
+    constexpr value_storage_compact() noexcept
+        : _empty{}
+    {
+    }
+    value_storage_compact(const value_storage_compact &) = default;             // NOLINT
+    value_storage_compact(value_storage_compact &&) = default;                  // NOLINT
+    value_storage_compact &operator=(const value_storage_compact &) = default;  // NOLINT
+    value_storage_compact &operator=(value_storage_compact &&) = default;       // NOLINT
+    ~value_storage_compact() = default;
+    constexpr explicit value_storage_compact(status_bitfield_type status)
+        : _empty()
+        , _status(status)
+    {
+    }
+    template <class... Args>
+    constexpr explicit value_storage_compact(in_place_type_t<_value_type> /*unused*/,
+                                             Args &&...args) noexcept(detail::is_nothrow_constructible<_value_type_, Args...>)
+        : _value(static_cast<Args &&>(args)...)
+        , _status(status::have_value)
+    {
+    }
+    template <class U, class... Args>
+    constexpr value_storage_compact(in_place_type_t<_value_type> /*unused*/, std::initializer_list<U> il,
+                                    Args &&...args) noexcept(detail::is_nothrow_constructible<_value_type_, std::initializer_list<U>, Args...>)
+        : _value(il, static_cast<Args &&>(args)...)
+        , _status(status::have_value)
+    {
+    }
+    template <class... Args>
+    constexpr explicit value_storage_compact(in_place_type_t<_error_type> /*unused*/,
+                                             Args &&...args) noexcept(detail::is_nothrow_constructible<_error_type_, Args...>)
+        : _error(static_cast<Args &&>(args)...)
+        , _status(status::have_error)
+    {
+      _set_error_is_errno(*this);
+    }
+    template <class U, class... Args>
+    constexpr value_storage_compact(in_place_type_t<_error_type> /*unused*/, std::initializer_list<U> il,
+                                    Args &&...args) noexcept(detail::is_nothrow_constructible<_error_type_, std::initializer_list<U>, Args...>)
+        : _error(il, static_cast<Args &&>(args)...)
+        , _status(status::have_error)
+    {
+      _set_error_is_errno(*this);
+    }
+
+    // From the state of any other basic_result, whose value or error may be void
+    template <class Src>
+    static constexpr bool enable_converting_constructor =
+    !std::is_same<Src, value_storage_compact>::value && is_value_storage_convertible<value_type, error_type, Src>::value;
+    OUTCOME_TEMPLATE(class Src)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<std::decay_t<Src>>))
+    constexpr explicit value_storage_compact(Src &&o)
+        : value_storage_compact(status_of(o).have_value() ?
+                                _convert_value(static_cast<Src &&>(o), std::is_void<typename std::decay_t<Src>::value_type>()) :
+                                (status_of(o).have_error() ? _convert_error(static_cast<Src &&>(o), std::is_void<typename std::decay_t<Src>::error_type>()) :
+                                                             value_storage_compact()))  // NOLINT
     {
-      _status = o._status;
+      _status = compact_status_type<T, E>(static_cast<status_bitfield_type>(status_of(o)));
+    }
+    constexpr void swap(value_storage_compact &o) noexcept
+    {
+      // storage is trivial, so just use assignment
+      auto temp = static_cast<value_storage_compact &&>(*this);
+      *this = static_cast<value_storage_compact &&>(o);
+      o = static_cast<value_storage_compact &&>(temp);
     }
 
-    struct void_error_converting_constructor_tag
+  private:
+    template <class Src> static constexpr value_storage_compact _convert_value(Src &&o, std::false_type /*source value is void*/)
     {
-    };
-    template <class U>
-    static constexpr bool enable_void_error_converting_constructor =
-    std::is_default_constructible<error_type>::value && detail::is_constructible<value_type, U>;
-    OUTCOME_TEMPLATE(class U)
-    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_error_converting_constructor<U>))
-    constexpr explicit value_storage_trivial(const value_storage_trivial<U, void> &o, void_error_converting_constructor_tag /*unused*/ = {}) noexcept(
-    detail::is_nothrow_constructible<_value_type_, U> && std::is_nothrow_default_constructible<_error_type_>::value)
-        : value_storage_trivial(o._status.have_value() ?
-                                value_storage_trivial(in_place_type<value_type>, o._value) :
-                                (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>) : value_storage_trivial()))  // NOLINT
+      // Forwarded as the source was
+      using src_value_type = std::remove_reference_t<decltype(value_of(o))>;
+      return value_storage_compact(in_place_type<value_type>,
+                                   static_cast<std::conditional_t<std::is_lvalue_reference<Src>::value, src_value_type &, src_value_type &&>>(value_of(o)));
+    }
+    template <class Src> static constexpr value_storage_compact _convert_value(Src && /*unused*/, std::true_type /*source value is void*/)
     {
-      _status = o._status;
+      return value_storage_compact(in_place_type<value_type>);
     }
-    OUTCOME_TEMPLATE(class U)
-    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_void_error_converting_constructor<U>))
-    constexpr explicit value_storage_trivial(value_storage_trivial<U, void> &&o, void_error_converting_constructor_tag /*unused*/ = {}) noexcept(
-    detail::is_nothrow_constructible<_value_type_, U> && std::is_nothrow_default_constructible<_error_type_>::value)
-        : value_storage_trivial(o._status.have_value() ?
-                                value_storage_trivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
-                                (o._status.have_error() ? value_storage_trivial(in_place_type<error_type>) : value_storage_trivial()))  // NOLINT
+    template <class Src> static constexpr value_storage_compact _convert_error(Src &&o, std::false_type /*source error is void*/)
     {
-      _status = o._status;
+      return value_storage_compact(in_place_type<error_type>, static_cast<Src &&>(o)._error);
     }
-    constexpr void swap(value_storage_trivial &o) noexcept
+    template <class Src> static constexpr value_storage_compact _convert_error(Src && /*unused*/, std::true_type /*source error is void*/)
     {
-      // storage is trivial, so just use assignment
-      auto temp = static_cast<value_storage_trivial &&>(*this);
-      *this = static_cast<value_storage_trivial &&>(o);
-      o = static_cast<value_storage_trivial &&>(temp);
+      return value_storage_compact(in_place_type<error_type>);
     }
   };
+  // The specialisations of value_storage_trivial with no status_bitfield_type gain nothing from a compact status
+  template <class T, class E> struct has_compact_status_storage : std::true_type
+  {
+  };
+  template <class T> struct has_compact_status_storage<T, packed_errno<T>> : std::false_type
+  {
+  };
+  template <class T> struct has_compact_status_storage<reference_storage<T>, void> : std::false_type
+  {
+  };
 
   /* Used if T or E is non-trivial. The additional constexpr is injected in C++ 20 to enable Outcome to
   work in constexpr evaluation contexts in C++ 20 where non-trivial constexpr destructors are now allowed.
@@ -599,11 +1198,11 @@ namespace detail
     {
       if(o._status.have_value())
       {
-        new(OUTCOME_ADDRESS_OF(_value)) _value_type_(static_cast<_value_type_ &&>(o._value));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_value), static_cast<_value_type_ &&>(o._value));  // NOLINT
       }
       else if(o._status.have_error())
       {
-        new(OUTCOME_ADDRESS_OF(_error)) _error_type_(static_cast<_error_type_ &&>(o._error));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_error), static_cast<_error_type_ &&>(o._error));  // NOLINT
       }
       _status = o._status;
       o._status.set_have_moved_from(true);
@@ -616,11 +1215,11 @@ namespace detail
     {
       if(o._status.have_value())
       {
-        new(OUTCOME_ADDRESS_OF(_value)) _value_type_(o._value);  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_value), o._value);  // NOLINT
       }
       else if(o._status.have_error())
       {
-        new(OUTCOME_ADDRESS_OF(_error)) _error_type_(o._error);  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_error), o._error);  // NOLINT
       }
       _status = o._status;
     }
@@ -675,43 +1274,43 @@ namespace detail
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
     constexpr explicit value_storage_nontrivial(const value_storage_trivial<U, V> &o, nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept(
     detail::is_nothrow_constructible<_value_type_, U> && detail::is_nothrow_constructible<_error_type_, V>)
-        : value_storage_nontrivial(o._status.have_value() ?
-                                   value_storage_nontrivial(in_place_type<value_type>, o._value) :
-                                   (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, o._error) : value_storage_nontrivial()))
+        : value_storage_nontrivial(status_of(o).have_value() ?
+                                   value_storage_nontrivial(in_place_type<value_type>, value_of(o)) :
+                                   (status_of(o).have_error() ? value_storage_nontrivial(in_place_type<error_type>, o._error) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = status_of(o);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
     constexpr explicit value_storage_nontrivial(value_storage_trivial<U, V> &&o, nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept(
     detail::is_nothrow_constructible<_value_type_, U> && detail::is_nothrow_constructible<_error_type_, V>)
         : value_storage_nontrivial(
-          o._status.have_value() ?
-          value_storage_nontrivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
-          (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_nontrivial()))
+          status_of(o).have_value() ?
+          value_storage_nontrivial(in_place_type<value_type>, static_cast<U &&>(value_of(o))) :
+          (status_of(o).have_error() ? value_storage_nontrivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = status_of(o);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
     constexpr explicit value_storage_nontrivial(const value_storage_nontrivial<U, V> &o, nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept(
     detail::is_nothrow_constructible<_value_type_, U> && detail::is_nothrow_constructible<_error_type_, V>)
-        : value_storage_nontrivial(o._status.have_value() ?
-                                   value_storage_nontrivial(in_place_type<value_type>, o._value) :
-                                   (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, o._error) : value_storage_nontrivial()))
+        : value_storage_nontrivial(status_of(o).have_value() ?
+                                   value_storage_nontrivial(in_place_type<value_type>, value_of(o)) :
+                                   (status_of(o).have_error() ? value_storage_nontrivial(in_place_type<error_type>, o._error) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = status_of(o);
     }
     OUTCOME_TEMPLATE(class U, class V)
     OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_nonvoid_converting_constructor<U, V>))
     constexpr explicit value_storage_nontrivial(value_storage_nontrivial<U, V> &&o, nonvoid_converting_constructor_tag /*unused*/ = {}) noexcept(
     detail::is_nothrow_constructible<_value_type_, U> && detail::is_nothrow_constructible<_error_type_, V>)
         : value_storage_nontrivial(
-          o._status.have_value() ?
-          value_storage_nontrivial(in_place_type<value_type>, static_cast<U &&>(o._value)) :
-          (o._status.have_error() ? value_storage_nontrivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_nontrivial()))
+          status_of(o).have_value() ?
+          value_storage_nontrivial(in_place_type<value_type>, static_cast<U &&>(value_of(o))) :
+          (status_of(o).have_error() ? value_storage_nontrivial(in_place_type<error_type>, static_cast<V &&>(o._error)) : value_storage_nontrivial()))
     {
-      _status = o._status;
+      _status = status_of(o);
     }
 
     struct void_value_converting_constructor_tag
@@ -727,11 +1326,11 @@ namespace detail
     {
       if(o._status.have_value())
       {
-        new(OUTCOME_ADDRESS_OF(_value)) _value_type_();  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_value));  // NOLINT
       }
       else if(o._status.have_error())
       {
-        new(OUTCOME_ADDRESS_OF(_error)) _error_type_(o._error);  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_error), o._error);  // NOLINT
       }
       _status = o._status;
     }
@@ -742,11 +1341,11 @@ namespace detail
     {
       if(o._status.have_value())
       {
-        new(OUTCOME_ADDRESS_OF(_value)) _value_type_();  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_value));  // NOLINT
       }
       else if(o._status.have_error())
       {
-        new(OUTCOME_ADDRESS_OF(_error)) _error_type_(static_cast<_error_type_ &&>(o._error));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_error), static_cast<_error_type_ &&>(o._error));  // NOLINT
       }
       _status = o._status;
       o._status.set_have_moved_from(true);
@@ -765,11 +1364,11 @@ namespace detail
     {
       if(o._status.have_value())
       {
-        new(OUTCOME_ADDRESS_OF(_value)) _value_type_(o._value);  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_value), o._value);  // NOLINT
       }
       else if(o._status.have_error())
       {
-        new(OUTCOME_ADDRESS_OF(_error)) _error_type_();  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_error));  // NOLINT
       }
       _status = o._status;
     }
@@ -780,11 +1379,11 @@ namespace detail
     {
       if(o._status.have_value())
       {
-        new(OUTCOME_ADDRESS_OF(_value)) _value_type_(static_cast<_value_type_ &&>(o._value));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_value), static_cast<_value_type_ &&>(o._value));  // NOLINT
       }
       else if(o._status.have_error())
       {
-        new(OUTCOME_ADDRESS_OF(_error)) _error_type_();  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_error));  // NOLINT
       }
       _status = o._status;
       o._status.set_have_moved_from(true);
@@ -816,9 +1415,17 @@ namespace detail
     constexpr
 #endif
     void
-    swap(value_storage_nontrivial &o) noexcept(detail::is_nothrow_swappable<_value_type_>::value && detail::is_nothrow_swappable<_error_type_>::value)
+    swap(value_storage_nontrivial &o) noexcept((detail::is_nothrow_swappable<_value_type_>::value && detail::is_nothrow_swappable<_error_type_>::value) ||
+                                               (trait::is_trivially_relocatable<_value_type_>::value &&
+                                                trait::is_trivially_relocatable<_error_type_>::value))
     {
       using std::swap;
+      // Neither cares where it lives, so whichever each holds, exchanging the bytes exchanges them
+      if(trait::is_trivially_relocatable<_value_type_>::value && trait::is_trivially_relocatable<_error_type_>::value && !is_constant_evaluated())
+      {
+        relocating_swap(*this, o);
+        return;
+      }
       // empty/empty
       if(!_status.have_value() && !o._status.have_value() && !_status.have_error() && !o._status.have_error())
       {
@@ -832,6 +1439,9 @@ namespace detail
         {
           status_bitfield_type &a, &b;
           bool all_good{false};
+#if __cplusplus >= 202000L || _HAS_CXX20
+          constexpr
+#endif
           ~some_type()
           {
             if(!this->all_good)
@@ -853,6 +1463,9 @@ namespace detail
         {
           status_bitfield_type &a, &b;
           bool all_good{false};
+#if __cplusplus >= 202000L || _HAS_CXX20
+          constexpr
+#endif
           ~some_type()
           {
             if(!this->all_good)
@@ -871,7 +1484,7 @@ namespace detail
       if(_status.have_value() && !o._status.have_error())
       {
         // Move construct me into other
-        new(OUTCOME_ADDRESS_OF(o._value)) _value_type_(static_cast<_value_type_ &&>(_value));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(o._value), static_cast<_value_type_ &&>(_value));  // NOLINT
         if(!trait::is_move_bitcopying<value_type>::value)
         {
           this->_value.~value_type();  // NOLINT
@@ -882,7 +1495,7 @@ namespace detail
       if(o._status.have_value() && !_status.have_error())
       {
         // Move construct other into me
-        new(OUTCOME_ADDRESS_OF(_value)) _value_type_(static_cast<_value_type_ &&>(o._value));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_value), static_cast<_value_type_ &&>(o._value));  // NOLINT
         if(!trait::is_move_bitcopying<value_type>::value)
         {
           o._value.~value_type();  // NOLINT
@@ -893,7 +1506,7 @@ namespace detail
       if(_status.have_error() && !o._status.have_value())
       {
         // Move construct me into other
-        new(OUTCOME_ADDRESS_OF(o._error)) _error_type_(static_cast<_error_type_ &&>(_error));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(o._error), static_cast<_error_type_ &&>(_error));  // NOLINT
         if(!trait::is_move_bitcopying<error_type>::value)
         {
           this->_error.~error_type();  // NOLINT
@@ -904,7 +1517,7 @@ namespace detail
       if(o._status.have_error() && !_status.have_value())
       {
         // Move construct other into me
-        new(OUTCOME_ADDRESS_OF(_error)) _error_type_(static_cast<_error_type_ &&>(o._error));  // NOLINT
+        placement_new(OUTCOME_ADDRESS_OF(_error), static_cast<_error_type_ &&>(o._error));  // NOLINT
         if(!trait::is_move_bitcopying<error_type>::value)
         {
           o._error.~error_type();  // NOLINT
@@ -919,6 +1532,9 @@ namespace detail
         _value_type_ *value, *o_value;
         _error_type_ *error, *o_error;
         bool all_good{true};
+#if __cplusplus >= 202000L || _HAS_CXX20
+        constexpr
+#endif
         ~some_type()
         {
           if(!this->all_good)
@@ -1194,14 +1810,434 @@ namespace detail
       make_ub(this->_value);
     }
   };
+
+  /* The exception type a no-value policy asks basic_outcome to overlap with the value and error (see
+  policy::exclusive_exception), else void. Storages holding such an exception name it the same way.
+  */
+  template <class T> struct exclusive_exception_type_of
+  {
+    template <class U> static typename U::exclusive_exception_type _test(int);
+    template <class U> static void _test(...);
+    using type = decltype(_test<T>(0));
+  };
+
+  /* Used by basic_outcome if its no-value policy is a policy::exclusive_exception. The exception shares the
+  union with the value and the error, so at most one of the three is ever present, and outcome<T> is
+  no bigger than result<T> when the exception is no bigger than the error.
+  */
+  template <class T, class E, class P> struct value_storage_exclusive
+  {
+    static_assert(!std::is_void<P>::value, "An exclusive exception type cannot be void");
+    using value_type = T;
+    using error_type = E;
+    using exclusive_exception_type = P;
+    struct disable_in_place_value_type
+    {
+    };
+    struct disable_in_place_error_type
+    {
+    };
+    using _value_type = std::conditional_t<std::is_same<value_type, error_type>::value, disable_in_place_value_type, value_type>;
+    using _error_type = std::conditional_t<std::is_same<value_type, error_type>::value, disable_in_place_error_type, error_type>;
+    using _value_type_ = devoid<value_type>;
+    using _error_type_ = devoid<error_type>;
+
+    union
+    {
+      empty_type _empty;
+      _value_type_ _value;
+      _error_type_ _error;
+      P _exception;
+    };
+    status_bitfield_type _status;
+
+    constexpr value_storage_exclusive() noexcept
+        : _empty{}
+    {
+    }
+    constexpr explicit value_storage_exclusive(status_bitfield_type status)
+        : _empty()
+        , _status(status)
+    {
+    }
+    template <class... Args>
+    constexpr explicit value_storage_exclusive(in_place_type_t<_value_type> /*unused*/,
+                                               Args &&...args) noexcept(detail::is_nothrow_constructible<_value_type_, Args...>)
+        : _value(static_cast<Args &&>(args)...)
+        , _status(status::have_value)
+    {
+    }
+    template <class U, class... Args>
+    constexpr value_storage_exclusive(in_place_type_t<_value_type> /*unused*/, std::initializer_list<U> il,
+                                      Args &&...args) noexcept(detail::is_nothrow_constructible<_value_type_, std::initializer_list<U>, Args...>)
+        : _value(il, static_cast<Args &&>(args)...)
+        , _status(status::have_value)
+    {
+    }
+    template <class... Args>
+    constexpr explicit value_storage_exclusive(in_place_type_t<_error_type> /*unused*/,
+                                               Args &&...args) noexcept(detail::is_nothrow_constructible<_error_type_, Args...>)
+        : _error(static_cast<Args &&>(args)...)
+        , _status(status::have_error)
+    {
+      _set_error_is_errno(*this);
+    }
+    template <class U, class... Args>
+    constexpr value_storage_exclusive(in_place_type_t<_error_type> /*unused*/, std::initializer_list<U> il,
+                                      Args &&...args) noexcept(detail::is_nothrow_constructible<_error_type_, std::initializer_list<U>, Args...>)
+        : _error(il, static_cast<Args &&>(args)...)
+        , _status(status::have_error)
+    {
+      _set_error_is_errno(*this);
+    }
+
+    value_storage_exclusive(const value_storage_exclusive &o) noexcept(std::is_nothrow_copy_constructible<_value_type_>::value &&
+                                                                       std::is_nothrow_copy_constructible<_error_type_>::value &&
+                                                                       std::is_nothrow_copy_constructible<P>::value)
+        : _empty()
+    {
+      _construct(o);
+    }
+    value_storage_exclusive(value_storage_exclusive &&o) noexcept(std::is_nothrow_move_constructible<_value_type_>::value &&
+                                                                  std::is_nothrow_move_constructible<_error_type_>::value &&
+                                                                  std::is_nothrow_move_constructible<P>::value)  // NOLINT
+        : _empty()
+    {
+      _construct(static_cast<value_storage_exclusive &&>(o));
+      o._status.set_have_moved_from(true);
+    }
+    value_storage_exclusive &operator=(const value_storage_exclusive &o) noexcept(
+    std::is_nothrow_copy_constructible<_value_type_>::value && std::is_nothrow_copy_constructible<_error_type_>::value &&
+    std::is_nothrow_copy_constructible<P>::value && std::is_nothrow_copy_assignable<_value_type_>::value &&
+    std::is_nothrow_copy_assignable<_error_type_>::value && std::is_nothrow_copy_assignable<P>::value)
+    {
+      if(this != &o)
+      {
+        _assign(o);
+      }
+      return *this;
+    }
+    value_storage_exclusive &operator=(value_storage_exclusive &&o) noexcept(
+    std::is_nothrow_move_constructible<_value_type_>::value && std::is_nothrow_move_constructible<_error_type_>::value &&
+    std::is_nothrow_move_constructible<P>::value && std::is_nothrow_move_assignable<_value_type_>::value &&
+    std::is_nothrow_move_assignable<_error_type_>::value && std::is_nothrow_move_assignable<P>::value)  // NOLINT
+    {
+      if(this != &o)
+      {
+        _assign(static_cast<value_storage_exclusive &&>(o));
+        o._status.set_have_moved_from(true);
+      }
+      return *this;
+    }
+    ~value_storage_exclusive() { _destroy(); }
+
+    // From the state of a basic_result, or of a basic_outcome whose exception is held outside its state
+    template <class U, class V>
+    static constexpr bool enable_converting_constructor = detail::is_constructible<_value_type_, devoid<U>> && detail::is_constructible<_error_type_, devoid<V>>;
+    OUTCOME_TEMPLATE(class U, class V)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U, V>))
+    explicit value_storage_exclusive(const value_storage_trivial<U, V> &o)
+        : _empty()
+    {
+      _construct(o);
+    }
+    OUTCOME_TEMPLATE(class U, class V)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U, V>))
+    explicit value_storage_exclusive(value_storage_trivial<U, V> &&o)
+        : _empty()
+    {
+      _construct(static_cast<value_storage_trivial<U, V> &&>(o));
+    }
+    OUTCOME_TEMPLATE(class U, class V)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U, V>))
+    explicit value_storage_exclusive(const value_storage_nontrivial<U, V> &o)
+        : _empty()
+    {
+      _construct(o);
+    }
+    OUTCOME_TEMPLATE(class U, class V)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U, V>))
+    explicit value_storage_exclusive(value_storage_nontrivial<U, V> &&o)
+        : _empty()
+    {
+      _construct(static_cast<value_storage_nontrivial<U, V> &&>(o));
+      o._status.set_have_moved_from(true);
+    }
+    template <class U, class V, class W>
+    static constexpr bool enable_exclusive_converting_constructor =
+    !(std::is_same<U, value_type>::value && std::is_same<V, error_type>::value && std::is_same<W, P>::value)  //
+    && enable_converting_constructor<U, V> && detail::is_constructible<P, W>;
+    OUTCOME_TEMPLATE(class U, class V, class W)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_exclusive_converting_constructor<U, V, W>))
+    explicit value_storage_exclusive(const value_storage_exclusive<U, V, W> &o)
+        : _empty()
+    {
+      _construct(o);
+    }
+    OUTCOME_TEMPLATE(class U, class V, class W)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_exclusive_converting_constructor<U, V, W>))
+    explicit value_storage_exclusive(value_storage_exclusive<U, V, W> &&o)
+        : _empty()
+    {
+      _construct(static_cast<value_storage_exclusive<U, V, W> &&>(o));
+      o._status.set_have_moved_from(true);
+    }
+
+    // Replaces whatever is held with an exception
+    template <class... Args> void _emplace_exception(Args &&...args)
+    {
+      _destroy();
+      placement_new(OUTCOME_ADDRESS_OF(_exception), static_cast<Args &&>(args)...);  // NOLINT
+      _status.set_have_exception(true);
+    }
+    template <class U> void _assign_exception(U &&v)
+    {
+      if(_status.have_exception())
+      {
+        _exception = static_cast<U &&>(v);
+        return;
+      }
+      _emplace_exception(static_cast<U &&>(v));
+    }
+
+    // Only the basic guarantee: if moving in throws, both are left empty with lost consistency
+    void swap(value_storage_exclusive &o) noexcept((std::is_nothrow_move_constructible<_value_type_>::value &&
+                                                    std::is_nothrow_move_constructible<_error_type_>::value &&
+                                                    std::is_nothrow_move_constructible<P>::value &&
+                                                    std::is_nothrow_move_assignable<_value_type_>::value &&
+                                                    std::is_nothrow_move_assignable<_error_type_>::value && std::is_nothrow_move_assignable<P>::value) ||
+                                                   (trait::is_trivially_relocatable<_value_type_>::value &&
+                                                    trait::is_trivially_relocatable<_error_type_>::value && trait::is_trivially_relocatable<P>::value))
+    {
+      if(trait::is_trivially_relocatable<_value_type_>::value && trait::is_trivially_relocatable<_error_type_>::value &&
+         trait::is_trivially_relocatable<P>::value && !is_constant_evaluated())
+      {
+        relocating_swap(*this, o);
+        return;
+      }
+      value_storage_exclusive temp(static_cast<value_storage_exclusive &&>(o));
+      o._assign(static_cast<value_storage_exclusive &&>(*this));
+      _assign(static_cast<value_storage_exclusive &&>(temp));
+    }
+
+  private:
+    template <class Src> void _construct_exception(Src &&o, std::true_type /*source holds its exception*/)
+    {
+      placement_new(OUTCOME_ADDRESS_OF(_exception), static_cast<Src &&>(o)._exception);  // NOLINT
+    }
+    template <class Src> void _construct_exception(Src && /*unused*/, std::false_type /*source holds its exception*/) {}
+
+    // Leaves any exception bit set only if the source held the exception within its state
+    template <class Src> void _construct(Src &&o)
+    {
+      using holds_exception = std::integral_constant<bool, !std::is_void<typename exclusive_exception_type_of<std::decay_t<Src>>::type>::value>;
+      if(o._status.have_value())
+      {
+        placement_new(OUTCOME_ADDRESS_OF(_value), static_cast<Src &&>(o)._value);  // NOLINT
+      }
+      else if(o._status.have_error())
+      {
+        placement_new(OUTCOME_ADDRESS_OF(_error), static_cast<Src &&>(o)._error);  // NOLINT
+      }
+      else if(o._status.have_exception())
+      {
+        _construct_exception(static_cast<Src &&>(o), holds_exception());
+      }
+      _status = o._status;
+      if(!holds_exception::value)
+      {
+        _status.set_have_exception(false);
+      }
+    }
+    template <class Src> void _assign(Src &&o)
+    {
+      if(_status.have_value() && o._status.have_value())
+      {
+        _value = static_cast<Src &&>(o)._value;
+      }
+      else if(_status.have_error() && o._status.have_error())
+      {
+        _error = static_cast<Src &&>(o)._error;
+      }
+      else if(_status.have_exception() && o._status.have_exception())
+      {
+        _exception = static_cast<Src &&>(o)._exception;
+      }
+      else
+      {
+        _destroy();
+        _status.set_have_lost_consistency(true);
+        _construct(static_cast<Src &&>(o));
+        return;
+      }
+      _status = o._status;
+    }
+    void _destroy() noexcept
+    {
+      if(_status.have_value())
+      {
+        _value.~_value_type_();  // NOLINT
+      }
+      else if(_status.have_error())
+      {
+        _error.~_error_type_();  // NOLINT
+      }
+      else if(_status.have_exception())
+      {
+        _exception.~P();  // NOLINT
+      }
+      _status.set_have_value(false).set_have_error(false).set_have_exception(false);
+    }
+  };
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 
+  /* Used by `basic_result::emplace_value()` and friends. A value or error already held is assigned to
+  if it can be, so it keeps whatever it has allocated. Otherwise whatever is held is destroyed before
+  constructing, so if that throws the storage is left holding neither, with lost consistency set as
+  swap and assignment between value and error do.
+  */
+  template <class T, class... Args> struct is_assignable_from_one : std::false_type
+  {
+  };
+  template <class T, class Arg> struct is_assignable_from_one<T, Arg> : std::is_assignable<T &, Arg>
+  {
+  };
+  template <class State> constexpr inline bool storage_holds_value(const State &s) noexcept
+  {
+    return status_of(s).have_value() && (!trait::is_move_bitcopying<typename State::value_type>::value || !status_of(s).have_moved_from());
+  }
+  template <class State> constexpr inline bool storage_holds_error(const State &s) noexcept
+  {
+    return status_of(s).have_error() && (!trait::is_move_bitcopying<typename State::error_type>::value || !status_of(s).have_moved_from());
+  }
+  template <class State>
+  constexpr inline void storage_destroy(State &s) noexcept(std::is_nothrow_destructible<typename State::_value_type_>::value &&
+                                                            std::is_nothrow_destructible<typename State::_error_type_>::value)
+  {
+    using _value_type_ = typename State::_value_type_;
+    using _error_type_ = typename State::_error_type_;
+    if(storage_holds_value(s))
+    {
+      s._value.~_value_type_();  // NOLINT
+    }
+    else if(storage_holds_error(s))
+    {
+      s._error.~_error_type_();  // NOLINT
+    }
+    s._status.set_have_value(false).set_have_error(false).set_have_error_is_errno(false).set_have_lost_consistency(false).set_have_moved_from(false);
+  }
+  template <class State, class... Args> constexpr inline void storage_construct_value(State &s, Args &&...args)
+  {
+    storage_destroy(s);
+    s._status.set_have_lost_consistency(true);
+    placement_new(OUTCOME_ADDRESS_OF(s._value), static_cast<Args &&>(args)...);
+    s._status.set_have_value(true).set_have_lost_consistency(false);
+  }
+  template <class State, class... Args> constexpr inline void storage_construct_error(State &s, Args &&...args)
+  {
+    storage_destroy(s);
+    s._status.set_have_lost_consistency(true);
+    placement_new(OUTCOME_ADDRESS_OF(s._error), static_cast<Args &&>(args)...);
+    s._status.set_have_error(true).set_have_lost_consistency(false);
+    _set_error_is_errno(s);
+  }
+  // The error of a `basic_result<T &, void>` is a null pointer
+  template <class T> constexpr inline void storage_construct_error(value_storage_trivial<reference_storage<T>, void> &s) noexcept
+  {
+    s._value = reference_storage<T>();
+  }
+  // The value and the error of a `sysresult<T>` are both its one word, which is replaced
+  template <class T, class... Args> constexpr inline void storage_construct_value(value_storage_trivial<T, packed_errno<T>> &s, Args &&...args)
+  {
+    s = value_storage_trivial<T, packed_errno<T>>(in_place_type<T>, static_cast<Args &&>(args)...);
+  }
+  template <class T, class... Args> constexpr inline void storage_construct_error(value_storage_trivial<T, packed_errno<T>> &s, Args &&...args)
+  {
+    s = value_storage_trivial<T, packed_errno<T>>(in_place_type<packed_errno<T>>, static_cast<Args &&>(args)...);
+  }
+
+  template <class State, class... Args> constexpr inline void storage_emplace_value(std::false_type /*unused*/, State &s, Args &&...args)
+  {
+    storage_construct_value(s, static_cast<Args &&>(args)...);
+  }
+  template <class State, class Arg> constexpr inline void storage_emplace_value(std::true_type /*unused*/, State &s, Arg &&arg)
+  {
+    if(storage_holds_value(s))
+    {
+      s._value = static_cast<Arg &&>(arg);
+      s._status.set_have_moved_from(false);
+      return;
+    }
+    storage_construct_value(s, static_cast<Arg &&>(arg));
+  }
+  template <class State, class... Args> constexpr inline void storage_emplace_value(State &s, Args &&...args)
+  {
+    using assignable = std::integral_constant<bool, is_assignable_from_one<typename State::_value_type_, Args...>::value>;
+    storage_emplace_value(assignable(), s, static_cast<Args &&>(args)...);
+  }
+  template <class T, class... Args> constexpr inline void storage_emplace_value(value_storage_trivial<T, packed_errno<T>> &s, Args &&...args)
+  {
+    storage_construct_value(s, static_cast<Args &&>(args)...);
+  }
+  template <class State, class... Args> constexpr inline void storage_emplace_error(std::false_type /*unused*/, State &s, Args &&...args)
+  {
+    storage_construct_error(s, static_cast<Args &&>(args)...);
+  }
+  template <class State, class Arg> constexpr inline void storage_emplace_error(std::true_type /*unused*/, State &s, Arg &&arg)
+  {
+    if(storage_holds_error(s))
+    {
+      s._error = static_cast<Arg &&>(arg);
+      s._status.set_have_error_is_errno(false).set_have_moved_from(false);
+      _set_error_is_errno(s);
+      return;
+    }
+    storage_construct_error(s, static_cast<Arg &&>(arg));
+  }
+  template <class State, class... Args> constexpr inline void storage_emplace_error(State &s, Args &&...args)
+  {
+    using assignable = std::integral_constant<bool, is_assignable_from_one<typename State::_error_type_, Args...>::value>;
+    storage_emplace_error(assignable(), s, static_cast<Args &&>(args)...);
+  }
+  template <class T, class... Args> constexpr inline void storage_emplace_error(value_storage_trivial<T, packed_errno<T>> &s, Args &&...args)
+  {
+    storage_construct_error(s, static_cast<Args &&>(args)...);
+  }
+
+  /* Selecting the storage for every basic_result and basic_outcome evaluates a dozen
+  traits per type, so if the compiler has the type trait builtins we use those directly.
+  */
+  namespace storage_traits
+  {
+#if OUTCOME_USE_TYPE_TRAIT_BUILTINS
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_copyable = __is_trivially_copyable(T);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_copy_constructible = __is_trivially_constructible(T, const T &);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_copy_constructible = __is_constructible(T, const T &);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_move_constructible = __is_constructible(T, T &&);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_default_constructible = __is_constructible(T);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_copy_assignable = __is_trivially_assignable(T &, const T &);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_move_assignable = __is_trivially_assignable(T &, T &&);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_copy_assignable = __is_assignable(T &, const T &);
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_move_assignable = __is_assignable(T &, T &&);
+#else
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_copyable = std::is_trivially_copyable<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_copy_constructible = std::is_trivially_copy_constructible<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_copy_constructible = std::is_copy_constructible<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_move_constructible = std::is_move_constructible<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_default_constructible = std::is_default_constructible<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_copy_assignable = std::is_trivially_copy_assignable<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_trivially_move_assignable = std::is_trivially_move_assignable<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_copy_assignable = std::is_copy_assignable<T>::value;
+    template <class T> OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool is_move_assignable = std::is_move_assignable<T>::value;
+#endif
+  }  // namespace storage_traits
+
   // is_trivially_copyable is true even if type is not copyable, so handle that here
   template <class T> struct is_storage_trivial
   {
-    static constexpr bool value = std::is_void<T>::value || (std::is_trivially_copy_constructible<T>::value && std::is_trivially_copyable<T>::value);
+    static constexpr bool value = storage_traits::is_trivially_copy_constructible<T> && storage_traits::is_trivially_copyable<T>;
   };
   // work around libstdc++ 7 bug
   template <> struct is_storage_trivial<void>
@@ -1215,40 +2251,74 @@ namespace detail
   // Ability to do copy assigns needs more than just copy assignment
   template <class T> struct is_copy_assignable
   {
-    static constexpr bool value = std::is_copy_assignable<T>::value && (std::is_copy_constructible<T>::value || std::is_default_constructible<T>::value);
+    static constexpr bool value =
+    storage_traits::is_copy_assignable<T> && (storage_traits::is_copy_constructible<T> || storage_traits::is_default_constructible<T>);
   };
   // Ability to do move assigns needs more than just move assignment
   template <class T> struct is_move_assignable
   {
-    static constexpr bool value = std::is_move_assignable<T>::value && (std::is_move_constructible<T>::value || std::is_default_constructible<T>::value);
+    static constexpr bool value =
+    storage_traits::is_move_assignable<T> && (storage_traits::is_move_constructible<T> || storage_traits::is_default_constructible<T>);
   };
 
-  template <class T, class E>
+  template <class T, class E, bool Compact = false>
   using value_storage_select_trivality =
-  std::conditional_t<is_storage_trivial<T>::value && is_storage_trivial<E>::value, value_storage_trivial<T, E>, value_storage_nontrivial<T, E>>;
-  template <class T, class E>
+  std::conditional_t<is_storage_trivial<T>::value && is_storage_trivial<E>::value,
+                     std::conditional_t<Compact && has_compact_status_storage<T, E>::value, value_storage_compact<T, E>, value_storage_trivial<T, E>>,
+                     value_storage_nontrivial<T, E>>;
+  template <class T, class E, bool Compact = false>
   using value_storage_select_move_constructor =
-  std::conditional_t<std::is_move_constructible<devoid<T>>::value && std::is_move_constructible<devoid<E>>::value, value_storage_select_trivality<T, E>,
-                     value_storage_delete_move_constructor<value_storage_select_trivality<T, E>>>;
-  template <class T, class E>
+  std::conditional_t<storage_traits::is_move_constructible<devoid<T>> && storage_traits::is_move_constructible<devoid<E>>,
+                     value_storage_select_trivality<T, E, Compact>,
+                     value_storage_delete_move_constructor<value_storage_select_trivality<T, E, Compact>>>;
+  template <class T, class E, bool Compact = false>
   using value_storage_select_copy_constructor =
-  std::conditional_t<std::is_copy_constructible<devoid<T>>::value && std::is_copy_constructible<devoid<E>>::value, value_storage_select_move_constructor<T, E>,
-                     value_storage_delete_copy_constructor<value_storage_select_move_constructor<T, E>>>;
-  template <class T, class E>
+  std::conditional_t<storage_traits::is_copy_constructible<devoid<T>> && storage_traits::is_copy_constructible<devoid<E>>,
+                     value_storage_select_move_constructor<T, E, Compact>,
+                     value_storage_delete_copy_constructor<value_storage_select_move_constructor<T, E, Compact>>>;
+  template <class T, class E, bool Compact = false>
   using value_storage_select_move_assignment =
-  std::conditional_t<std::is_trivially_move_assignable<devoid<T>>::value && std::is_trivially_move_assignable<devoid<E>>::value,
-                     value_storage_select_copy_constructor<T, E>,
+  std::conditional_t<storage_traits::is_trivially_move_assignable<devoid<T>> && storage_traits::is_trivially_move_assignable<devoid<E>>,
+                     value_storage_select_copy_constructor<T, E, Compact>,
                      std::conditional_t<is_move_assignable<devoid<T>>::value && is_move_assignable<devoid<E>>::value,
-                                        value_storage_nontrivial_move_assignment<value_storage_select_copy_constructor<T, E>>,
-                                        value_storage_delete_move_assignment<value_storage_select_copy_constructor<T, E>>>>;
-  template <class T, class E>
+                                        value_storage_nontrivial_move_assignment<value_storage_select_copy_constructor<T, E, Compact>>,
+                                        value_storage_delete_move_assignment<value_storage_select_copy_constructor<T, E, Compact>>>>;
+  template <class T, class E, bool Compact = false>
   using value_storage_select_copy_assignment =
-  std::conditional_t<std::is_trivially_copy_assignable<devoid<T>>::value && std::is_trivially_copy_assignable<devoid<E>>::value,
-                     value_storage_select_move_assignment<T, E>,
+  std::conditional_t<storage_traits::is_trivially_copy_assignable<devoid<T>> && storage_traits::is_trivially_copy_assignable<devoid<E>>,
+                     value_storage_select_move_assignment<T, E, Compact>,
                      std::conditional_t<is_copy_assignable<devoid<T>>::value && is_copy_assignable<devoid<E>>::value,
-                                        value_storage_nontrivial_copy_assignment<value_storage_select_move_assignment<T, E>>,
-                                        value_storage_delete_copy_assignment<value_storage_select_move_assignment<T, E>>>>;
-  template <class T, class E> using value_storage_select_impl = value_storage_select_copy_assignment<T, E>;
+                                        value_storage_nontrivial_copy_assignment<value_storage_select_move_assignment<T, E, Compact>>,
+                                        value_storage_delete_copy_assignment<value_storage_select_move_assignment<T, E, Compact>>>>;
+  template <class T, class E, bool Compact = false> using value_storage_select_impl = value_storage_select_copy_assignment<T, E, Compact>;
+  template <class T, class E, class P>
+  using value_storage_select_exclusive_move =
+  std::conditional_t<storage_traits::is_move_constructible<devoid<T>> && storage_traits::is_move_constructible<devoid<E>> &&
+                     storage_traits::is_move_constructible<P>,
+                     value_storage_exclusive<T, E, P>, value_storage_delete_move_assignment<value_storage_delete_move_constructor<value_storage_exclusive<T, E, P>>>>;
+  template <class T, class E, class P>
+  using value_storage_select_exclusive =
+  std::conditional_t<storage_traits::is_copy_constructible<devoid<T>> && storage_traits::is_copy_constructible<devoid<E>> &&
+                     storage_traits::is_copy_constructible<P>,
+                     value_storage_select_exclusive_move<T, E, P>,
+                     value_storage_delete_copy_assignment<value_storage_delete_copy_constructor<value_storage_select_exclusive_move<T, E, P>>>>;
+  // Whether a no-value policy asks for a one byte status without spare storage (see policy::compact_status)
+  template <class T> struct is_compact_status_policy
+  {
+    template <class U> static std::integral_constant<bool, U::compact_status_storage> _test(int);
+    template <class U> static std::false_type _test(...);
+    static constexpr bool value = decltype(_test<T>(0))::value;
+  };
+  // The state of a basic_result_storage, which overlaps the exception of basic_outcome if its policy asks,
+  // or has a compact status if its policy asks
+  template <class T, class E, class NoValuePolicy, class P = typename exclusive_exception_type_of<NoValuePolicy>::type> struct value_storage_select_state
+  {
+    using type = value_storage_select_exclusive<T, E, P>;
+  };
+  template <class T, class E, class NoValuePolicy> struct value_storage_select_state<T, E, NoValuePolicy, void>
+  {
+    using type = value_storage_select_impl<T, E, is_compact_status_policy<NoValuePolicy>::value>;
+  };
 #ifndef NDEBUG
   // Check is trivial in all ways except default constructibility
   // static_assert(std::is_trivial<value_storage_select_impl<int, long>>::value, "value_storage_select_impl<int, long> is not trivial!");
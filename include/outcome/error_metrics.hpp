@@ -0,0 +1,429 @@
+/* Sharded failure counters for result and outcome
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_METRICS_HPP
+#define OUTCOME_ERROR_METRICS_HPP
+
+#include "error_trace.hpp"
+
+#include <cstddef>  // for offsetof
+#include <map>
+#include <new>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! The number of distinct (domain, value) counters per thread. Must be a power of two.
+#ifndef OUTCOME_ERROR_METRICS_SHARD_SIZE
+#define OUTCOME_ERROR_METRICS_SHARD_SIZE 256
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+namespace metrics
+{
+  static_assert((OUTCOME_ERROR_METRICS_SHARD_SIZE & (OUTCOME_ERROR_METRICS_SHARD_SIZE - 1)) == 0, "OUTCOME_ERROR_METRICS_SHARD_SIZE must be a power of two");
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  sample. Potential doc page: NOT FOUND
+*/
+  struct sample
+  {
+    uint64_t domain_id{0};  // Address of the std::error_category, or the status code domain's unique id
+    std::string domain;     // Name of the category or domain
+    int64_t value{0};       // Integral error value, or zero if not available
+    uint64_t count{0};      // Failures constructed since process start
+  };
+
+  namespace detail
+  {
+    using name_function = std::string (*)(const void *domain);
+
+    struct counter_key
+    {
+      uint64_t domain_id;
+      const void *domain;
+      name_function name;
+      int64_t value;
+    };
+
+    template <class Category> inline std::string category_name(const void *domain) { return static_cast<const Category *>(domain)->name(); }
+    template <class Domain> inline std::string domain_name(const void *domain)
+    {
+      auto n = static_cast<const Domain *>(domain)->name();
+      return std::string(n.c_str(), n.size());
+    }
+    inline std::string signature_name(const void *domain) { return trace::detail::type_name_from_signature(static_cast<const char *>(domain)); }
+    inline std::string exception_name(const void * /*unused*/) { return "exception"; }
+    inline const char *exception_domain() noexcept
+    {
+      static const char v = 0;
+      return &v;
+    }
+
+    using OUTCOME_V2_NAMESPACE::detail::priority;
+    // SG14 status codes are keyed by domain id, as the same domain may have an instance per shared library
+    template <class E>
+    inline auto key_of(const E &e, priority<3> /*unused*/) noexcept -> decltype(static_cast<uint64_t>(e.domain().id()), static_cast<int64_t>(e.value()), counter_key())
+    {
+      using domain_type = typename std::decay<decltype(e.domain())>::type;
+      return {static_cast<uint64_t>(e.domain().id()), OUTCOME_ADDRESS_OF(e.domain()), &domain_name<domain_type>, static_cast<int64_t>(e.value())};
+    }
+    template <class E>
+    inline auto key_of(const E &e, priority<2> /*unused*/) noexcept -> decltype(static_cast<int64_t>(e.value()), e.category().name(), counter_key())
+    {
+      using category_type = typename std::decay<decltype(e.category())>::type;
+      return {reinterpret_cast<uint64_t>(OUTCOME_ADDRESS_OF(e.category())), OUTCOME_ADDRESS_OF(e.category()), &category_name<category_type>,  // NOLINT
+              static_cast<int64_t>(e.value())};
+    }
+    template <class E, typename std::enable_if<std::is_integral<E>::value || std::is_enum<E>::value, bool>::type = true>
+    inline counter_key key_of(const E &e, priority<1> /*unused*/) noexcept
+    {
+      const char *sig = OUTCOME_V2_NAMESPACE::detail::type_signature<E>();
+      return {reinterpret_cast<uint64_t>(sig), sig, &signature_name, static_cast<int64_t>(e)};  // NOLINT
+    }
+    template <class E> inline counter_key key_of(const E & /*unused*/, priority<0> /*unused*/) noexcept
+    {
+      const char *sig = OUTCOME_V2_NAMESPACE::detail::type_signature<E>();
+      return {reinterpret_cast<uint64_t>(sig), sig, &signature_name, 0};  // NOLINT
+    }
+
+    // One open addressed table of counters per thread. Only the owning thread inserts keys or increments counts,
+    // so an increment is an uncontended relaxed load and store. Each counter fills a cache line, and so does the
+    // shard header, so neither readers nor neighbouring shards disturb the writer.
+    struct alignas(64) shard
+    {
+      struct alignas(64) slot
+      {
+        std::atomic<bool> used{false};  // published last, after the key
+        std::atomic<uint64_t> domain_id{0};
+        std::atomic<uint64_t> domain{0};
+        std::atomic<uint64_t> name{0};
+        std::atomic<int64_t> value{0};
+        std::atomic<uint64_t> count{0};
+      };
+
+      std::atomic<bool> in_use{true};
+      std::atomic<uint64_t> overflowed{0};  // failures not counted as the shard was full
+      shard *next{nullptr};
+      slot slots[OUTCOME_ERROR_METRICS_SHARD_SIZE];
+
+      static size_t hash(uint64_t domain_id, int64_t value) noexcept
+      {
+        uint64_t h = domain_id ^ (static_cast<uint64_t>(value) * 0x9e3779b97f4a7c15ULL);
+        h ^= h >> 29;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 32;
+        return static_cast<size_t>(h);
+      }
+
+      void increment(const counter_key &k) noexcept
+      {
+        const size_t mask = OUTCOME_ERROR_METRICS_SHARD_SIZE - 1;
+        for(size_t n = 0, idx = hash(k.domain_id, k.value) & mask; n < OUTCOME_ERROR_METRICS_SHARD_SIZE; n++, idx = (idx + 1) & mask)
+        {
+          slot &s = slots[idx];
+          if(!s.used.load(std::memory_order_relaxed))
+          {
+            s.domain_id.store(k.domain_id, std::memory_order_relaxed);
+            s.domain.store(reinterpret_cast<uintptr_t>(k.domain), std::memory_order_relaxed);  // NOLINT
+            s.name.store(reinterpret_cast<uintptr_t>(k.name), std::memory_order_relaxed);      // NOLINT
+            s.value.store(k.value, std::memory_order_relaxed);
+            s.count.store(1, std::memory_order_relaxed);
+            s.used.store(true, std::memory_order_release);
+            return;
+          }
+          if(s.domain_id.load(std::memory_order_relaxed) == k.domain_id && s.value.load(std::memory_order_relaxed) == k.value)
+          {
+            s.count.store(s.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+          }
+        }
+        overflowed.store(overflowed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      }
+    };
+    static_assert(sizeof(shard::slot) == 64, "shard::slot should fill exactly one cache line");
+    static_assert(offsetof(shard, slots) == 64, "shard header should fill exactly one cache line");
+
+    // Failures not counted as their thread had no shard
+    inline std::atomic<uint64_t> &unallocated() noexcept
+    {
+      static std::atomic<uint64_t> v{0};
+      return v;
+    }
+
+    // Shards are never freed, so readers may walk this list at any time without locks
+    inline std::atomic<shard *> &shard_list() noexcept
+    {
+      static std::atomic<shard *> v{nullptr};
+      return v;
+    }
+
+    // Shards are never freed, so before C++ 17 aligned new they are simply over allocated and aligned by hand
+    inline shard *allocate_shard() noexcept
+    {
+#ifdef __cpp_aligned_new
+      return new(std::nothrow) shard;
+#else
+      void *p = ::operator new(sizeof(shard) + alignof(shard) - 1, std::nothrow);
+      if(p == nullptr)
+      {
+        return nullptr;
+      }
+      const uintptr_t aligned = (reinterpret_cast<uintptr_t>(p) + alignof(shard) - 1) & ~static_cast<uintptr_t>(alignof(shard) - 1);  // NOLINT
+      return new(reinterpret_cast<void *>(aligned)) shard;                                                                            // NOLINT
+#endif
+    }
+
+    // Returns null if a new shard could not be allocated
+    inline shard *claim_shard() noexcept
+    {
+      // Reuse the shard of an exited thread if there is one, so its counts are not lost
+      for(shard *s = shard_list().load(std::memory_order_acquire); s != nullptr; s = s->next)
+      {
+        bool expected = false;
+        if(s->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+          return s;
+        }
+      }
+      auto *s = allocate_shard();
+      if(s == nullptr)
+      {
+        return nullptr;
+      }
+      s->next = shard_list().load(std::memory_order_relaxed);
+      while(!shard_list().compare_exchange_weak(s->next, s, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+      return s;
+    }
+
+    // Trivially destructible, so still readable once this thread's shard_owner has been destroyed
+    inline bool &this_thread_shard_destroyed() noexcept
+    {
+      static thread_local bool v;
+      return v;
+    }
+
+    struct shard_owner
+    {
+      shard *s{nullptr};  // claimed by the first failure on this thread
+      shard_owner() = default;
+      shard_owner(const shard_owner &) = delete;
+      shard_owner(shard_owner &&) = delete;
+      shard_owner &operator=(const shard_owner &) = delete;
+      shard_owner &operator=(shard_owner &&) = delete;
+      ~shard_owner()
+      {
+        if(s != nullptr)
+        {
+          s->in_use.store(false, std::memory_order_release);
+          s = nullptr;
+        }
+        this_thread_shard_destroyed() = true;
+      }
+    };
+
+    // A failure is counted as unallocated rather than terminating the noexcept caller if no shard could be
+    // claimed for this thread. A later failure on the same thread retries. So is a failure during thread exit
+    // once the shard has been released, say from the destructor of another thread_local, as another thread
+    // may since have claimed it.
+    inline void increment(const counter_key &k) noexcept
+    {
+      if(this_thread_shard_destroyed())
+      {
+        unallocated().fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      static thread_local shard_owner v;
+      if(v.s == nullptr)
+      {
+        v.s = claim_shard();
+        if(v.s == nullptr)
+        {
+          unallocated().fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+      }
+      v.s->increment(k);
+    }
+
+    inline void prometheus_escape(std::ostream &s, const std::string &v)
+    {
+      for(char c : v)
+      {
+        switch(c)
+        {
+        case '"':
+          s << "\\\"";
+          break;
+        case '\\':
+          s << "\\\\";
+          break;
+        case '\n':
+          s << "\\n";
+          break;
+        default:
+          s << c;
+        }
+      }
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class E> OUTCOME_FORCEINLINE inline void record(const E &error) noexcept { detail::increment(detail::key_of(error, detail::priority<3>())); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void record_exception() noexcept
+  {
+    const char *domain = detail::exception_domain();
+    detail::increment({reinterpret_cast<uint64_t>(domain), domain, &detail::exception_name, 0});  // NOLINT
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void merge(std::vector<sample> &into, const std::vector<sample> &from)
+  {
+    std::map<std::pair<uint64_t, int64_t>, size_t> index;
+    for(size_t n = 0; n < into.size(); n++)
+    {
+      index.emplace(std::make_pair(into[n].domain_id, into[n].value), n);
+    }
+    for(const auto &s : from)
+    {
+      auto it = index.find(std::make_pair(s.domain_id, s.value));
+      if(it != index.end())
+      {
+        into[it->second].count += s.count;
+      }
+      else
+      {
+        index.emplace(std::make_pair(s.domain_id, s.value), into.size());
+        into.push_back(s);
+      }
+    }
+    std::sort(into.begin(), into.end(), [](const sample &a, const sample &b) { return (a.domain != b.domain) ? (a.domain < b.domain) : (a.value < b.value); });
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline std::vector<sample> snapshot()
+  {
+    std::vector<sample> ret;
+    for(const detail::shard *sh = detail::shard_list().load(std::memory_order_acquire); sh != nullptr; sh = sh->next)
+    {
+      std::vector<sample> part;
+      for(const auto &s : sh->slots)
+      {
+        if(s.used.load(std::memory_order_acquire))
+        {
+          sample v;
+          v.domain_id = s.domain_id.load(std::memory_order_relaxed);
+          v.value = s.value.load(std::memory_order_relaxed);
+          v.count = s.count.load(std::memory_order_relaxed);
+          auto name = reinterpret_cast<detail::name_function>(static_cast<uintptr_t>(s.name.load(std::memory_order_relaxed)));  // NOLINT
+          v.domain = name(reinterpret_cast<const void *>(static_cast<uintptr_t>(s.domain.load(std::memory_order_relaxed))));     // NOLINT
+          part.push_back(std::move(v));
+        }
+      }
+      merge(ret, part);
+    }
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline uint64_t overflowed() noexcept
+  {
+    uint64_t ret = detail::unallocated().load(std::memory_order_relaxed);
+    for(const detail::shard *sh = detail::shard_list().load(std::memory_order_acquire); sh != nullptr; sh = sh->next)
+    {
+      ret += sh->overflowed.load(std::memory_order_relaxed);
+    }
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline std::ostream &write_prometheus(std::ostream &s, const std::vector<sample> &samples, const char *metric = "outcome_failures_total")
+  {
+    s << "# HELP " << metric << " Failed result and outcome constructed, by error domain and value.\n";
+    s << "# TYPE " << metric << " counter\n";
+    for(const auto &v : samples)
+    {
+      s << metric << "{domain=\"";
+      detail::prometheus_escape(s, v.domain);
+      s << "\",value=\"" << v.value << "\"} " << v.count << "\n";
+    }
+    return s;
+  }
+}  // namespace metrics
+
+namespace policy
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class Base> error_metrics. Potential doc page: NOT FOUND
+*/
+  template <class Base> struct error_metrics : OUTCOME_V2_NAMESPACE::detail::failure_hooks<error_metrics<Base>, Base>
+  {
+  private:
+    friend OUTCOME_V2_NAMESPACE::detail::failure_hooks<error_metrics<Base>, Base>;
+
+    template <class T> OUTCOME_FORCEINLINE static void _count_error(T *inst, std::true_type /*has error type*/) noexcept { metrics::record(base::_error(*inst)); }
+    template <class T> OUTCOME_FORCEINLINE static void _count_error(T * /*unused*/, std::false_type /*has error type*/) noexcept
+    {
+      const char *sig = OUTCOME_V2_NAMESPACE::detail::type_signature<void>();
+      metrics::detail::increment({reinterpret_cast<uint64_t>(sig), sig, &metrics::detail::signature_name, 0});  // NOLINT
+    }
+    // Successful results cost only the test of a status bit the compiler usually already knows
+    template <class T> OUTCOME_FORCEINLINE static void _on_construction(T *inst, const void * /*unused*/) noexcept
+    {
+      if(base::_has_error(*inst))
+      {
+        _count_error(inst, std::integral_constant<bool, !std::is_void<typename T::error_type>::value>());
+      }
+      else if(base::_has_exception(*inst))
+      {
+        metrics::record_exception();
+      }
+    }
+  };
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,419 @@
+/* Per-thread failure tracing for result and outcome
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_TRACE_HPP
+#define OUTCOME_ERROR_TRACE_HPP
+
+#include "detail/failure_hooks.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <new>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#pragma intrinsic(__rdtsc)
+#endif
+
+//! The number of failures retained per thread. Must be a power of two.
+#ifndef OUTCOME_ERROR_TRACE_RING_SIZE
+#define OUTCOME_ERROR_TRACE_RING_SIZE 256
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+namespace trace
+{
+  static_assert((OUTCOME_ERROR_TRACE_RING_SIZE & (OUTCOME_ERROR_TRACE_RING_SIZE - 1)) == 0, "OUTCOME_ERROR_TRACE_RING_SIZE must be a power of two");
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  event. Potential doc page: NOT FOUND
+*/
+  struct event
+  {
+    uint32_t thread_id{0};          // Outcome assigned id of the thread which constructed the failure
+    uint64_t ticks{0};              // TSC (or steady clock nanoseconds) at construction
+    const void *return_address{nullptr};  // Innermost non-inlined return address at construction
+    const char *type_signature{nullptr};  // Compiler generated signature naming the result or outcome type
+    const char *domain{nullptr};    // Category name of the error, or null if not available
+    int64_t value{0};               // Integral error value, or zero if not available
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline uint64_t ticks() noexcept
+  {
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+    return static_cast<uint64_t>(__rdtsc());
+#elif(defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    return static_cast<uint64_t>(__builtin_ia32_rdtsc());
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    uint64_t v;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+  }
+
+  namespace detail
+  {
+    // One ring per thread. Only the owning thread ever writes to it, so writes are wait free. Readers on other
+    // threads use head as a sequence lock to discard any slots which may have been overwritten during a copy.
+    struct thread_ring
+    {
+      struct slot
+      {
+        std::atomic<uint64_t> ticks{0};
+        std::atomic<uintptr_t> return_address{0};
+        std::atomic<uintptr_t> type_signature{0};
+        std::atomic<uintptr_t> domain{0};
+        std::atomic<int64_t> value{0};
+        std::atomic<uint32_t> thread_id{0};
+      };
+
+      std::atomic<uint64_t> head{0};
+      std::atomic<uint32_t> thread_id{0};
+      std::atomic<bool> in_use{true};
+      thread_ring *next{nullptr};
+      slot slots[OUTCOME_ERROR_TRACE_RING_SIZE];
+
+      void push(uint64_t ts, const void *ra, const char *signature, const char *domain, int64_t value) noexcept
+      {
+        const uint64_t h = head.load(std::memory_order_relaxed);
+        // Order the publish of the previous entry before we begin overwriting the oldest slot
+        std::atomic_thread_fence(std::memory_order_release);
+        slot &s = slots[h & (OUTCOME_ERROR_TRACE_RING_SIZE - 1)];
+        s.ticks.store(ts, std::memory_order_relaxed);
+        s.return_address.store(reinterpret_cast<uintptr_t>(ra), std::memory_order_relaxed);     // NOLINT
+        s.type_signature.store(reinterpret_cast<uintptr_t>(signature), std::memory_order_relaxed);  // NOLINT
+        s.domain.store(reinterpret_cast<uintptr_t>(domain), std::memory_order_relaxed);         // NOLINT
+        s.value.store(value, std::memory_order_relaxed);
+        s.thread_id.store(thread_id.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        head.store(h + 1, std::memory_order_release);
+      }
+
+      void read(std::vector<event> &out) const
+      {
+        const uint64_t h1 = head.load(std::memory_order_acquire);
+        const uint64_t begin = (h1 > OUTCOME_ERROR_TRACE_RING_SIZE) ? h1 - OUTCOME_ERROR_TRACE_RING_SIZE : 0;
+        const size_t first = out.size();
+        for(uint64_t n = begin; n < h1; n++)
+        {
+          const slot &s = slots[n & (OUTCOME_ERROR_TRACE_RING_SIZE - 1)];
+          event e;
+          e.thread_id = s.thread_id.load(std::memory_order_relaxed);
+          e.ticks = s.ticks.load(std::memory_order_relaxed);
+          e.return_address = reinterpret_cast<const void *>(s.return_address.load(std::memory_order_relaxed));  // NOLINT
+          e.type_signature = reinterpret_cast<const char *>(s.type_signature.load(std::memory_order_relaxed));  // NOLINT
+          e.domain = reinterpret_cast<const char *>(s.domain.load(std::memory_order_relaxed));                  // NOLINT
+          e.value = s.value.load(std::memory_order_relaxed);
+          out.push_back(e);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // The writer may be part way through overwriting the slot of entry h2, so anything at or
+        // before h2 - OUTCOME_ERROR_TRACE_RING_SIZE may be torn
+        const uint64_t h2 = head.load(std::memory_order_relaxed);
+        if(h2 + 1 > begin + OUTCOME_ERROR_TRACE_RING_SIZE)
+        {
+          const uint64_t torn = std::min<uint64_t>(h2 + 1 - OUTCOME_ERROR_TRACE_RING_SIZE - begin, h1 - begin);
+          out.erase(out.begin() + static_cast<ptrdiff_t>(first), out.begin() + static_cast<ptrdiff_t>(first + torn));
+        }
+      }
+    };
+
+    // Rings are never freed, so readers may walk this list at any time without locks
+    inline std::atomic<thread_ring *> &ring_list() noexcept
+    {
+      static std::atomic<thread_ring *> v{nullptr};
+      return v;
+    }
+
+    struct clock_origin_t
+    {
+      uint64_t ticks;
+      std::chrono::steady_clock::time_point steady;
+    };
+    inline const clock_origin_t &clock_origin() noexcept
+    {
+      static const clock_origin_t v{trace::ticks(), std::chrono::steady_clock::now()};
+      return v;
+    }
+
+    // Returns null if a new ring could not be allocated
+    inline thread_ring *claim_ring() noexcept
+    {
+      static std::atomic<uint32_t> next_thread_id{1};
+      (void) clock_origin();
+      const uint32_t tid = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+      // Reuse the ring of an exited thread if there is one, retaining its history
+      for(thread_ring *r = ring_list().load(std::memory_order_acquire); r != nullptr; r = r->next)
+      {
+        bool expected = false;
+        if(r->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+          r->thread_id.store(tid, std::memory_order_relaxed);
+          return r;
+        }
+      }
+      auto *r = new(std::nothrow) thread_ring;
+      if(r == nullptr)
+      {
+        return nullptr;
+      }
+      r->thread_id.store(tid, std::memory_order_relaxed);
+      r->next = ring_list().load(std::memory_order_relaxed);
+      while(!ring_list().compare_exchange_weak(r->next, r, std::memory_order_release, std::memory_order_relaxed))
+      {
+      }
+      return r;
+    }
+
+    // Trivially destructible, so still readable once this thread's ring_owner has been destroyed
+    inline bool &this_thread_ring_destroyed() noexcept
+    {
+      static thread_local bool v;
+      return v;
+    }
+
+    struct ring_owner
+    {
+      thread_ring *ring;
+      ring_owner() noexcept
+          : ring(claim_ring())
+      {
+      }
+      ring_owner(const ring_owner &) = delete;
+      ring_owner(ring_owner &&) = delete;
+      ring_owner &operator=(const ring_owner &) = delete;
+      ring_owner &operator=(ring_owner &&) = delete;
+      ~ring_owner()
+      {
+        if(ring != nullptr)
+        {
+          ring->in_use.store(false, std::memory_order_release);
+          ring = nullptr;
+        }
+        this_thread_ring_destroyed() = true;
+      }
+    };
+
+    // Returns null if this thread has no ring, in which case the failure is not recorded. A later failure
+    // on the same thread retries the allocation, except during thread exit once the ring has been released,
+    // say from the destructor of another thread_local, as another thread may since have claimed it.
+    inline thread_ring *this_thread_ring() noexcept
+    {
+      if(this_thread_ring_destroyed())
+      {
+        return nullptr;
+      }
+      static thread_local ring_owner v;
+      if(v.ring == nullptr)
+      {
+        v.ring = claim_ring();
+      }
+      return v.ring;
+    }
+
+    // Extract the user facing type name from the compiler generated signature
+    inline std::string type_name_from_signature(const char *sig)
+    {
+      if(sig == nullptr)
+      {
+        return {};
+      }
+      std::string s(sig);
+      auto idx = s.find("T = ");
+      if(idx != std::string::npos)
+      {
+        s = s.substr(idx + 4);
+        auto end = s.find_first_of(";]");
+        return (end != std::string::npos) ? s.substr(0, end) : s;
+      }
+      idx = s.find("type_signature<");
+      if(idx != std::string::npos)
+      {
+        s = s.substr(idx + 15);
+        auto end = s.rfind(">(");
+        return (end != std::string::npos) ? s.substr(0, end) : s;
+      }
+      return s;
+    }
+
+    inline void json_escape(std::ostream &s, const std::string &v)
+    {
+      for(char c : v)
+      {
+        switch(c)
+        {
+        case '"':
+          s << "\\\"";
+          break;
+        case '\\':
+          s << "\\\\";
+          break;
+        case '\n':
+          s << "\\n";
+          break;
+        default:
+          if(static_cast<unsigned char>(c) < 0x20)
+          {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));  // NOLINT
+            s << buffer;
+          }
+          else
+          {
+            s << c;
+          }
+        }
+      }
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class T, class E>
+  OUTCOME_FORCEINLINE inline void record(const T * /*unused*/, const E &error, const void *return_address = OUTCOME_ERROR_TRACE_RETURN_ADDRESS()) noexcept
+  {
+    const uint64_t ts = trace::ticks();
+    const auto info = OUTCOME_V2_NAMESPACE::detail::extract_error_info(error, OUTCOME_V2_NAMESPACE::detail::priority<2>());
+    if(auto *ring = detail::this_thread_ring())
+    {
+      ring->push(ts, return_address, OUTCOME_V2_NAMESPACE::detail::type_signature<T>(), info.domain, info.value);
+    }
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline std::vector<event> snapshot()
+  {
+    std::vector<event> ret;
+    for(const detail::thread_ring *r = detail::ring_list().load(std::memory_order_acquire); r != nullptr; r = r->next)
+    {
+      r->read(ret);
+    }
+    std::stable_sort(ret.begin(), ret.end(), [](const event &a, const event &b) { return a.ticks < b.ticks; });
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline double ticks_per_microsecond() noexcept
+  {
+    const auto &origin = detail::clock_origin();
+    const uint64_t t = trace::ticks();
+    const auto now = std::chrono::steady_clock::now();
+    const double us = std::chrono::duration<double, std::micro>(now - origin.steady).count();
+    if(us <= 0 || t <= origin.ticks)
+    {
+      return 1000.0;  // assume nanoseconds if the clock has not advanced
+    }
+    return static_cast<double>(t - origin.ticks) / us;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline std::ostream &write_chrome_trace(std::ostream &s, const std::vector<event> &events)
+  {
+    const double scale = ticks_per_microsecond();
+    const uint64_t base = detail::clock_origin().ticks;
+    s << "{\"traceEvents\":[";
+    bool first = true;
+    for(const auto &e : events)
+    {
+      if(!first)
+      {
+        s << ",";
+      }
+      first = false;
+      const double ts = (e.ticks >= base) ? static_cast<double>(e.ticks - base) / scale : 0.0;
+      char buffer[64];
+      s << "\n{\"name\":\"";
+      detail::json_escape(s, detail::type_name_from_signature(e.type_signature));
+      snprintf(buffer, sizeof(buffer), "%.3f", ts);  // NOLINT
+      s << "\",\"cat\":\"outcome\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << e.thread_id << ",\"ts\":" << buffer << ",\"args\":{\"value\":" << e.value;
+      if(e.domain != nullptr)
+      {
+        s << ",\"domain\":\"";
+        detail::json_escape(s, e.domain);
+        s << "\"";
+      }
+      snprintf(buffer, sizeof(buffer), "%p", e.return_address);  // NOLINT
+      s << ",\"return_address\":\"" << buffer << "\"}}";
+    }
+    s << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    return s;
+  }
+}  // namespace trace
+
+namespace policy
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class Base> error_trace. Potential doc page: NOT FOUND
+*/
+  template <class Base> struct error_trace : OUTCOME_V2_NAMESPACE::detail::failure_hooks<error_trace<Base>, Base>
+  {
+  private:
+    friend OUTCOME_V2_NAMESPACE::detail::failure_hooks<error_trace<Base>, Base>;
+
+    template <class T> OUTCOME_FORCEINLINE static void _trace_error(T *inst, const void *ra, std::true_type /*has error type*/) noexcept
+    {
+      trace::record(inst, base::_error(*inst), ra);
+    }
+    template <class T> OUTCOME_FORCEINLINE static void _trace_error(T *inst, const void *ra, std::false_type /*has error type*/) noexcept
+    {
+      trace::record(inst, 0, ra);
+    }
+    // Failed results are recorded, successful ones cost only the test of a status bit the compiler usually already knows
+    template <class T> OUTCOME_FORCEINLINE static void _on_construction(T *inst, const void *ra) noexcept
+    {
+      if(base::_has_error(*inst))
+      {
+        _trace_error(inst, ra, std::integral_constant<bool, !std::is_void<typename T::error_type>::value>());
+      }
+      else if(base::_has_exception(*inst))
+      {
+        trace::record(inst, 0, ra);
+      }
+    }
+  };
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,55 @@
+/* An outcome whose exception overlaps its value and error
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXCLUSIVE_OUTCOME_HPP
+#define OUTCOME_EXCLUSIVE_OUTCOME_HPP
+
+#include "std_outcome.hpp"
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace policy
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class P, class Base> exclusive_exception. Potential doc page: NOT FOUND
+*/
+  template <class P, class Base> struct exclusive_exception : Base
+  {
+    /* A basic_outcome with this policy keeps its exception of type P in the same union as its value
+    and error, so it can never hold an error and an exception at once. Constructing from an error plus
+    an exception is disabled, and converting from an outcome which holds both keeps the exception.
+    */
+    using exclusive_exception_type = P;
+  };
+}  // namespace policy
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class R, class S = std::error_code, class P = std::exception_ptr, class NoValuePolicy = policy::default_policy<R, S, P>>  //
+using exclusive_outcome = basic_outcome<R, S, P, policy::exclusive_exception<P, NoValuePolicy>>;
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
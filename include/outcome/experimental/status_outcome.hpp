@@ -128,6 +128,7 @@ SIGNATURE NOT RECOGNISED
       {
         if(!base::_has_value(static_cast<Impl &&>(self)))
         {
+          base::_on_wide_value_check_failure(self);
           if(base::_has_exception(static_cast<Impl &&>(self)))
           {
             OUTCOME_V2_NAMESPACE::policy::detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>(
@@ -127,6 +127,7 @@ namespace experimental
       {
         if(!base::_has_value(static_cast<Impl &&>(self)))
         {
+          base::_on_wide_value_check_failure(self);
           if(base::_has_error(static_cast<Impl &&>(self)))
           {
 #ifdef __cpp_exceptions
@@ -0,0 +1,87 @@
+/* Explicit instantiations of commonly used result and outcome types
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXTERN_TEMPLATES_HPP
+#define OUTCOME_EXTERN_TEMPLATES_HPP
+
+/* Declares `std_result<T>` and `std_outcome<T>` for each `T` in OUTCOME_EXTERN_TEMPLATE_VALUE_TYPES
+to be explicitly instantiated elsewhere, so translation units do not instantiate their non-template
+member functions themselves. outcome.hpp includes this if OUTCOME_USE_EXTERN_TEMPLATES is true, which
+linking to the outcome::extern_templates library built from src/extern_templates.cpp defines. Everything
+linking to that library must use the same value types, and the same C++ exceptions and RTTI settings.
+*/
+
+#include "std_outcome.hpp"
+
+#include <string>
+
+//! A sequence of parenthesised value types, none of which may contain a top level comma
+#ifndef OUTCOME_EXTERN_TEMPLATE_VALUE_TYPES
+#define OUTCOME_EXTERN_TEMPLATE_VALUE_TYPES (void)(int)(std::string)
+#endif
+
+//! `extern template` to declare the instantiations, `template` to define them
+#ifndef OUTCOME_EXTERN_TEMPLATE
+#define OUTCOME_EXTERN_TEMPLATE extern template
+#endif
+
+// Most of the member functions are those of the base classes, so those are instantiated too
+#define OUTCOME_EXTERN_TEMPLATE_POLICY(T, E) policy::default_policy<T, std::error_code, E>
+#define OUTCOME_EXTERN_TEMPLATE_STORAGE(T, E) detail::basic_result_storage<T, std::error_code, OUTCOME_EXTERN_TEMPLATE_POLICY(T, E)>
+#define OUTCOME_EXTERN_TEMPLATE_VALUE_OBSERVERS(T, E)                                                                                                          \
+  detail::basic_result_value_observers<OUTCOME_EXTERN_TEMPLATE_STORAGE(T, E), T, OUTCOME_EXTERN_TEMPLATE_POLICY(T, E)>
+#define OUTCOME_EXTERN_TEMPLATE_EXCEPTION_OBSERVERS(T)                                                                                                         \
+  detail::basic_outcome_exception_observers<detail::basic_result_final<T, std::error_code, OUTCOME_EXTERN_TEMPLATE_POLICY(T, std::exception_ptr)>, T,          \
+                                            std::error_code, std::exception_ptr, OUTCOME_EXTERN_TEMPLATE_POLICY(T, std::exception_ptr)>
+#define OUTCOME_EXTERN_TEMPLATE_RESULT_BASES(T, E)                                                                                                             \
+  OUTCOME_EXTERN_TEMPLATE class OUTCOME_EXTERN_TEMPLATE_STORAGE(T, E);                                                                                         \
+  OUTCOME_EXTERN_TEMPLATE class OUTCOME_EXTERN_TEMPLATE_VALUE_OBSERVERS(T, E);                                                                                 \
+  OUTCOME_EXTERN_TEMPLATE class detail::basic_result_error_observers<OUTCOME_EXTERN_TEMPLATE_VALUE_OBSERVERS(T, E), std::error_code,                           \
+                                                                     OUTCOME_EXTERN_TEMPLATE_POLICY(T, E)>;                                                    \
+  OUTCOME_EXTERN_TEMPLATE class detail::basic_result_final<T, std::error_code, OUTCOME_EXTERN_TEMPLATE_POLICY(T, E)>;
+#define OUTCOME_EXTERN_TEMPLATE_INSTANTIATE(T)                                                                                                                 \
+  OUTCOME_EXTERN_TEMPLATE_RESULT_BASES(T, void)                                                                                                                \
+  OUTCOME_EXTERN_TEMPLATE class basic_result<T, std::error_code, OUTCOME_EXTERN_TEMPLATE_POLICY(T, void)>;                                                     \
+  OUTCOME_EXTERN_TEMPLATE_RESULT_BASES(T, std::exception_ptr)                                                                                                  \
+  OUTCOME_EXTERN_TEMPLATE class OUTCOME_EXTERN_TEMPLATE_EXCEPTION_OBSERVERS(T);                                                                                \
+  OUTCOME_EXTERN_TEMPLATE class detail::basic_outcome_failure_observers<OUTCOME_EXTERN_TEMPLATE_EXCEPTION_OBSERVERS(T), T, std::error_code, std::exception_ptr, \
+                                                                        OUTCOME_EXTERN_TEMPLATE_POLICY(T, std::exception_ptr)>;                                \
+  OUTCOME_EXTERN_TEMPLATE class basic_outcome<T, std::error_code, std::exception_ptr, OUTCOME_EXTERN_TEMPLATE_POLICY(T, std::exception_ptr)>;
+// Walks the sequence by alternating between two macros, so neither is expanded within itself
+#define OUTCOME_EXTERN_TEMPLATE_EACH_A(T) OUTCOME_EXTERN_TEMPLATE_INSTANTIATE(T) OUTCOME_EXTERN_TEMPLATE_EACH_B
+#define OUTCOME_EXTERN_TEMPLATE_EACH_B(T) OUTCOME_EXTERN_TEMPLATE_INSTANTIATE(T) OUTCOME_EXTERN_TEMPLATE_EACH_A
+#define OUTCOME_EXTERN_TEMPLATE_EACH_A_END
+#define OUTCOME_EXTERN_TEMPLATE_EACH_B_END
+// The instantiations contain commas, so the sequence is pasted to its terminator as variadic arguments
+#define OUTCOME_EXTERN_TEMPLATE_GLUE2(b, ...) __VA_ARGS__##b
+#define OUTCOME_EXTERN_TEMPLATE_GLUE(b, ...) OUTCOME_EXTERN_TEMPLATE_GLUE2(b, __VA_ARGS__)
+#define OUTCOME_EXTERN_TEMPLATE_EXPAND(x) x
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+OUTCOME_EXTERN_TEMPLATE_GLUE(_END, OUTCOME_EXTERN_TEMPLATE_EXPAND(OUTCOME_EXTERN_TEMPLATE_EACH_A OUTCOME_EXTERN_TEMPLATE_VALUE_TYPES))
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
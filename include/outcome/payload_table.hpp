@@ -0,0 +1,222 @@
+/* Side table of payloads indexed by result's spare storage
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_PAYLOAD_TABLE_HPP
+#define OUTCOME_PAYLOAD_TABLE_HPP
+
+#include "basic_result.hpp"
+
+#include <atomic>
+#include <cstring>  // for memcpy
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  template <size_t N> struct payload_table_log2
+  {
+    static constexpr size_t value = 1 + payload_table_log2<N / 2>::value;
+  };
+  template <> struct payload_table_log2<1>
+  {
+    static constexpr size_t value = 0;
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class Payload, size_t N, size_t MaxThreads> payload_table. Potential doc page: NOT FOUND
+
+A process wide table of `Payload`, keyed by the sixteen bits of spare storage in every `basic_result`.
+Each thread writes only to its own `N` slot ring, so storing a payload is wait free. Keys encode which
+thread's ring was written and a tag which detects when the slot has since been reused, so a result may be
+inspected from any thread, including after the thread which created it has exited.
+
+The low `log2(MaxThreads)` bits of a key select the ring, the remaining bits are the tag. Key zero, which
+is the default spare storage, never refers to a payload. Tags wrap after `tag_period` stores to the same
+ring, after which a key still held is indistinguishable from the newer key with the same tag and would find
+the newer payload. A key is reliably detected as stale only between `N` and `tag_period` stores after it
+was issued. The defaults of sixteen slots and thirty-two live threads give eleven tag bits and a
+`tag_period` of 2032; trading thread bits for tag bits lengthens the period.
+*/
+template <class Payload, size_t N = 16, size_t MaxThreads = 32> class payload_table
+{
+  static_assert(std::is_trivially_copyable<Payload>::value, "Payload must be trivially copyable, as it may be copied while being overwritten");
+  static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of two");
+  static_assert(MaxThreads > 0 && (MaxThreads & (MaxThreads - 1)) == 0, "MaxThreads must be a power of two");
+
+public:
+  //! The number of key bits which select a thread's ring
+  static constexpr size_t thread_bits = detail::payload_table_log2<MaxThreads>::value;
+  //! The number of key bits which tag a slot
+  static constexpr size_t tag_bits = 16 - thread_bits;
+  static_assert(thread_bits < 16 && (size_t(1) << tag_bits) > 2 * N, "Not enough spare storage bits remain to detect stale slots");
+
+private:
+  // Tags cycle through [N, _tag_max] so they are never zero, and the cycle is a multiple of N so every slot is used in turn
+  static constexpr uint16_t _tag_max = static_cast<uint16_t>(((size_t(1) << tag_bits) / N) * N - 1);
+
+public:
+  //! The number of stores to a ring after which its tags repeat, and an old key aliases a newer payload
+  static constexpr size_t tag_period = _tag_max + 1 - N;
+
+private:
+
+  struct _slot
+  {
+    std::atomic<uint16_t> tag{0};  // zero whilst being written
+    Payload payload;
+  };
+  struct _ring
+  {
+    std::atomic<bool> in_use{true};
+    uint16_t next_tag{N};  // retained across reuse by another thread so old keys remain stale
+    _slot slots[N];
+  };
+
+  // Rings are never freed, so lookups from any thread need no locks
+  static std::atomic<_ring *> *_rings() noexcept
+  {
+    static std::atomic<_ring *> v[MaxThreads];
+    return v;
+  }
+
+  struct _owner
+  {
+    _ring *ring{nullptr};
+    uint16_t index{0};
+    _owner() noexcept
+    {
+      auto *rings = _rings();
+      for(size_t n = 0; n < MaxThreads; n++)
+      {
+        _ring *r = rings[n].load(std::memory_order_acquire);
+        if(r == nullptr)
+        {
+          auto *nr = new(std::nothrow) _ring;
+          if(nr == nullptr)
+          {
+            return;
+          }
+          if(rings[n].compare_exchange_strong(r, nr, std::memory_order_acq_rel))
+          {
+            ring = nr;
+            index = static_cast<uint16_t>(n);
+            return;
+          }
+          delete nr;
+        }
+        bool expected = false;
+        if(r->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+          ring = r;
+          index = static_cast<uint16_t>(n);
+          return;
+        }
+      }
+    }
+    _owner(const _owner &) = delete;
+    _owner(_owner &&) = delete;
+    _owner &operator=(const _owner &) = delete;
+    _owner &operator=(_owner &&) = delete;
+    ~_owner()
+    {
+      if(ring != nullptr)
+      {
+        ring->in_use.store(false, std::memory_order_release);
+      }
+    }
+  };
+  static _owner &_this_thread() noexcept
+  {
+    static thread_local _owner v;
+    return v;
+  }
+
+public:
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  static uint16_t store(const Payload &p) noexcept
+  {
+    _owner &o = _this_thread();
+    if(o.ring == nullptr)
+    {
+      return 0;  // more than MaxThreads threads are alive
+    }
+    const uint16_t tag = o.ring->next_tag;
+    o.ring->next_tag = static_cast<uint16_t>((tag == _tag_max) ? N : (tag + 1));
+    _slot &s = o.ring->slots[tag & (N - 1)];
+    s.tag.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&s.payload, &p, sizeof(Payload));  // NOLINT
+    s.tag.store(tag, std::memory_order_release);
+    return static_cast<uint16_t>((tag << thread_bits) | o.index);
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  static bool find(uint16_t key, Payload &out) noexcept
+  {
+    const uint16_t tag = static_cast<uint16_t>(key >> thread_bits);
+    if(tag < N)
+    {
+      return false;
+    }
+    const _ring *r = _rings()[key & (MaxThreads - 1)].load(std::memory_order_acquire);
+    if(r == nullptr)
+    {
+      return false;
+    }
+    const _slot &s = r->slots[tag & (N - 1)];
+    if(s.tag.load(std::memory_order_acquire) != tag)
+    {
+      return false;
+    }
+    memcpy(&out, &s.payload, sizeof(Payload));  // NOLINT
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // If the slot was reused whilst we were copying, what we copied may be torn
+    return s.tag.load(std::memory_order_relaxed) == tag;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R, class S, class NoValuePolicy> static void attach(detail::basic_result_storage<R, S, NoValuePolicy> *r, const Payload &p) noexcept
+  {
+    hooks::set_spare_storage(r, store(p));
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R, class S, class NoValuePolicy> static bool find(const detail::basic_result_storage<R, S, NoValuePolicy> *r, Payload &out) noexcept
+  {
+    return find(hooks::spare_storage(r), out);
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
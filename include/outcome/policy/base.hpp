@@ -90,21 +90,80 @@ SIGNATURE NOT RECOGNISED
     template <class... Args> static constexpr void _silence_unused(Args &&... /*unused*/) noexcept {}
   protected:
     template <class Impl> static constexpr void _make_ub(Impl &&self) noexcept { return detail::make_ub(static_cast<Impl &&>(self)); }
-    template <class Impl> static constexpr bool _has_value(Impl &&self) noexcept { return self._state._status.have_value(); }
-    template <class Impl> static constexpr bool _has_error(Impl &&self) noexcept { return self._state._status.have_error(); }
-    template <class Impl> static constexpr bool _has_exception(Impl &&self) noexcept { return self._state._status.have_exception(); }
-    template <class Impl> static constexpr bool _has_error_is_errno(Impl &&self) noexcept { return self._state._status.have_error_is_errno(); }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr bool _has_value(Impl &&self) noexcept
+    {
+      return OUTCOME_V2_NAMESPACE::detail::status_of(self._state).have_value();
+    }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr bool _has_error(Impl &&self) noexcept
+    {
+      return OUTCOME_V2_NAMESPACE::detail::status_of(self._state).have_error();
+    }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr bool _has_exception(Impl &&self) noexcept
+    {
+      return OUTCOME_V2_NAMESPACE::detail::status_of(self._state).have_exception();
+    }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr bool _has_error_is_errno(Impl &&self) noexcept
+    {
+      return OUTCOME_V2_NAMESPACE::detail::status_of(self._state).have_error_is_errno();
+    }
+
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void _set_has_value(Impl &&self, bool v) noexcept { self._state._status.set_have_value(v); }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void _set_has_error(Impl &&self, bool v) noexcept { self._state._status.set_have_error(v); }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void _set_has_exception(Impl &&self, bool v) noexcept
+    {
+      self._state._status.set_have_exception(v);
+    }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void _set_has_error_is_errno(Impl &&self, bool v) noexcept
+    {
+      self._state._status.set_have_error_is_errno(v);
+    }
 
-    template <class Impl> static constexpr void _set_has_value(Impl &&self, bool v) noexcept { self._state._status.set_have_value(v); }
-    template <class Impl> static constexpr void _set_has_error(Impl &&self, bool v) noexcept { self._state._status.set_have_error(v); }
-    template <class Impl> static constexpr void _set_has_exception(Impl &&self, bool v) noexcept { self._state._status.set_have_exception(v); }
-    template <class Impl> static constexpr void _set_has_error_is_errno(Impl &&self, bool v) noexcept { self._state._status.set_have_error_is_errno(v); }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr auto &&_value(Impl &&self) noexcept
+    {
+      auto &v = OUTCOME_V2_NAMESPACE::detail::value_of(self._state);
+      return static_cast<std::conditional_t<std::is_lvalue_reference<Impl>::value, decltype(v), std::remove_reference_t<decltype(v)> &&>>(v);
+    }
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr auto &&_error(Impl &&self) noexcept { return static_cast<Impl &&>(self)._state._error; }
 
-    template <class Impl> static constexpr auto &&_value(Impl &&self) noexcept { return static_cast<Impl &&>(self)._state._value; }
-    template <class Impl> static constexpr auto &&_error(Impl &&self) noexcept { return static_cast<Impl &&>(self)._state._error; }
+    // Observation points for tracing, which cost nothing unless OUTCOME_ENABLE_USDT is set
+    template <class T> static constexpr void _on_result_constructed(T *inst) noexcept
+    {
+#if OUTCOME_ENABLE_USDT
+      if(!OUTCOME_USDT_IS_CONSTANT_EVALUATED() && _has_error(*inst))
+      {
+        OUTCOME_V2_NAMESPACE::detail::usdt_result_failure<T>(OUTCOME_ADDRESS_OF(_error(*inst)));
+      }
+#else
+      (void) inst;
+#endif
+    }
+    template <class T> static constexpr void _on_outcome_constructed(T *inst) noexcept
+    {
+#if OUTCOME_ENABLE_USDT
+      if(!OUTCOME_USDT_IS_CONSTANT_EVALUATED() && (_has_error(*inst) || _has_exception(*inst)))
+      {
+        // The error is only constructed if there is one
+        OUTCOME_V2_NAMESPACE::detail::usdt_outcome_failure<T>(_has_error(*inst) ? OUTCOME_ADDRESS_OF(_error(*inst)) : nullptr);
+      }
+#else
+      (void) inst;
+#endif
+    }
+    template <class Impl> static constexpr void _on_wide_value_check_failure(Impl &&self) noexcept
+    {
+#if OUTCOME_ENABLE_USDT
+      if(!OUTCOME_USDT_IS_CONSTANT_EVALUATED())
+      {
+        OUTCOME_V2_NAMESPACE::detail::usdt_wide_value_check_failure<std::decay_t<Impl>>(_has_error(self) ? OUTCOME_ADDRESS_OF(_error(self)) : nullptr);
+      }
+#else
+      (void) self;
+#endif
+    }
 
   public:
-    template <class R, class S, class P, class NoValuePolicy, class Impl> static inline constexpr auto &&_exception(Impl &&self) noexcept;
+    template <class R, class S, class P, class NoValuePolicy, class Impl>
+    OUTCOME_OBSERVER_INLINE static inline constexpr auto &&_exception(Impl &&self) noexcept;
 
     template <class T, class U> static constexpr inline void on_result_construction(T *inst, U &&v) noexcept
     {
@@ -115,6 +174,7 @@ SIGNATURE NOT RECOGNISED
       (void) inst;
       (void) v;
 #endif
+      _on_result_constructed(inst);
     }
     template <class T, class U> static constexpr inline void on_result_copy_construction(T *inst, U &&v) noexcept
     {
@@ -125,6 +185,7 @@ SIGNATURE NOT RECOGNISED
       (void) inst;
       (void) v;
 #endif
+      _on_result_constructed(inst);
     }
     template <class T, class U> static constexpr inline void on_result_move_construction(T *inst, U &&v) noexcept
     {
@@ -135,6 +196,7 @@ SIGNATURE NOT RECOGNISED
       (void) inst;
       (void) v;
 #endif
+      _on_result_constructed(inst);
     }
     template <class T, class U, class... Args>
     static constexpr inline void on_result_in_place_construction(T *inst, in_place_type_t<U> _, Args &&... args) noexcept
@@ -147,6 +209,7 @@ SIGNATURE NOT RECOGNISED
       (void) _;
       _silence_unused(static_cast<Args &&>(args)...);
 #endif
+      _on_result_constructed(inst);
     }
 
     template <class T, class... U> static constexpr inline void on_outcome_construction(T *inst, U &&... args) noexcept
@@ -158,6 +221,7 @@ SIGNATURE NOT RECOGNISED
       (void) inst;
       _silence_unused(static_cast<U &&>(args)...);
 #endif
+      _on_outcome_constructed(inst);
     }
     template <class T, class U> static constexpr inline void on_outcome_copy_construction(T *inst, U &&v) noexcept
     {
@@ -168,6 +232,7 @@ SIGNATURE NOT RECOGNISED
       (void) inst;
       (void) v;
 #endif
+      _on_outcome_constructed(inst);
     }
     template <class T, class U> static constexpr inline void on_outcome_move_construction(T *inst, U &&v) noexcept
     {
@@ -178,6 +243,7 @@ SIGNATURE NOT RECOGNISED
       (void) inst;
       (void) v;
 #endif
+      _on_outcome_constructed(inst);
     }
     template <class T, class U, class... Args>
     static constexpr inline void on_outcome_in_place_construction(T *inst, in_place_type_t<U> _, Args &&... args) noexcept
@@ -190,23 +256,24 @@ SIGNATURE NOT RECOGNISED
       (void) _;
       _silence_unused(static_cast<Args &&>(args)...);
 #endif
+      _on_outcome_constructed(inst);
     }
 
-    template <class Impl> static constexpr void narrow_value_check(Impl &&self) noexcept
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void narrow_value_check(Impl &&self) noexcept
     {
       if(!_has_value(self))
       {
         _make_ub(self);
       }
     }
-    template <class Impl> static constexpr void narrow_error_check(Impl &&self) noexcept
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void narrow_error_check(Impl &&self) noexcept
     {
       if(!_has_error(self))
       {
         _make_ub(self);
       }
     }
-    template <class Impl> static constexpr void narrow_exception_check(Impl &&self) noexcept
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void narrow_exception_check(Impl &&self) noexcept
     {
       if(!_has_exception(self))
       {
@@ -36,34 +36,34 @@ type definition  error_code_throw_as_system_error. Potential doc page: NOT FOUND
 */
   template <class T, class EC, class E> struct error_code_throw_as_system_error : base
   {
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        base::_on_wide_value_check_failure(self);
         if(base::_has_exception(std::forward<Impl>(self)))
         {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self))};  // NOLINT
+          detail::cold_rethrow_exception<trait::is_exception_ptr_available<E>::value>::rethrow(base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self)));  // NOLINT
         }
         if(base::_has_error(std::forward<Impl>(self)))
         {
-          // ADL discovered
-          outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
+          detail::throw_as_system_error_with_payload<bad_outcome_access>(base::_error(std::forward<Impl>(self)));
         }
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+        detail::throw_bad_outcome_access("no value");
       }
     }
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error"));  // NOLINT
+        detail::throw_bad_outcome_access("no error");
       }
     }
-    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));  // NOLINT
+        detail::throw_bad_outcome_access("no exception");
       }
     }
   };
@@ -36,33 +36,34 @@ type definition  exception_ptr_rethrow. Potential doc page: NOT FOUND
 */
   template <class T, class EC, class E> struct exception_ptr_rethrow : base
   {
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        base::_on_wide_value_check_failure(self);
         if(base::_has_exception(std::forward<Impl>(self)))
         {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, exception_ptr_rethrow>(std::forward<Impl>(self))};
+          detail::cold_rethrow_exception<trait::is_exception_ptr_available<E>::value>::rethrow(base::_exception<T, EC, E, exception_ptr_rethrow>(std::forward<Impl>(self)));
         }
         if(base::_has_error(std::forward<Impl>(self)))
         {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<EC>::value>{base::_error(std::forward<Impl>(self))};
+          detail::cold_rethrow_exception<trait::is_exception_ptr_available<EC>::value>::rethrow(base::_error(std::forward<Impl>(self)));
         }
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+        detail::throw_bad_outcome_access("no value");
       }
     }
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error"));  // NOLINT
+        detail::throw_bad_outcome_access("no error");
       }
     }
-    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));  // NOLINT
+        detail::throw_bad_outcome_access("no exception");
       }
     }
   };
@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_POLICY_RESULT_ERROR_CODE_THROW_AS_SYSTEM_ERROR_HPP
 
 #include "../bad_access.hpp"
+#include "../detail/throw_sites.hpp"
 #include "base.hpp"
 
 #include <system_error>
@@ -40,23 +41,23 @@ SIGNATURE NOT RECOGNISED
 */
   template <class T, class EC> struct error_code_throw_as_system_error<T, EC, void> : base
   {
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        base::_on_wide_value_check_failure(self);
         if(base::_has_error(std::forward<Impl>(self)))
         {
-          // ADL discovered
-          outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
+          detail::throw_as_system_error_with_payload<bad_result_access>(base::_error(std::forward<Impl>(self)));
         }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));  // NOLINT
+        detail::throw_bad_result_access("no value");
       }
     }
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error"));  // NOLINT
+        detail::throw_bad_result_access("no error");
       }
     }
   };
@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_POLICY_RESULT_EXCEPTION_PTR_RETHROW_HPP
 
 #include "../bad_access.hpp"
+#include "../detail/throw_sites.hpp"
 #include "base.hpp"
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
@@ -38,23 +39,23 @@ SIGNATURE NOT RECOGNISED
   template <class T, class EC, class E> struct exception_ptr_rethrow;
   template <class T, class EC> struct exception_ptr_rethrow<T, EC, void> : base
   {
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        base::_on_wide_value_check_failure(self);
         if(base::_has_error(std::forward<Impl>(self)))
         {
-          // ADL
-          rethrow_exception(policy::exception_ptr(base::_error(std::forward<Impl>(self))));
+          detail::rethrow_error<bad_result_access>(base::_error(std::forward<Impl>(self)));
         }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));  // NOLINT
+        detail::throw_bad_result_access("no value");
       }
     }
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error"));  // NOLINT
+        detail::throw_bad_result_access("no error");
       }
     }
   };
@@ -38,21 +38,22 @@ type definition  terminate. Potential doc page: `terminate`
 */
   struct terminate : base
   {
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(static_cast<Impl &&>(self)))
       {
+        base::_on_wide_value_check_failure(self);
         std::abort();
       }
     }
-    template <class Impl> static constexpr void wide_error_check(Impl &&self) noexcept
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_error_check(Impl &&self) noexcept
     {
       if(!base::_has_error(static_cast<Impl &&>(self)))
       {
         std::abort();
       }
     }
-    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(static_cast<Impl &&>(self)))
       {
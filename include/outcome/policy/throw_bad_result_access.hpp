@@ -26,6 +26,7 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_POLICY_THROW_BAD_RESULT_ACCESS_HPP
 
 #include "../bad_access.hpp"
+#include "../detail/throw_sites.hpp"
 #include "base.hpp"
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
@@ -37,46 +38,48 @@ type definition  throw_bad_result_access. Potential doc page: NOT FOUND
 */
   template <class EC, class EP> struct throw_bad_result_access : base
   {
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+        base::_on_wide_value_check_failure(self);
+        detail::throw_bad_outcome_access("no value");
       }
     }
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error"));  // NOLINT
+        detail::throw_bad_outcome_access("no error");
       }
     }
-    template <class Impl> static constexpr void wide_exception_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));  // NOLINT
+        detail::throw_bad_outcome_access("no exception");
       }
     }
   };
   template <class EC> struct throw_bad_result_access<EC, void> : base
   {
-    template <class Impl> static constexpr void wide_value_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_value_check(Impl &&self)
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
+        base::_on_wide_value_check_failure(self);
         if(base::_has_error(std::forward<Impl>(self)))
         {
-          OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(std::forward<Impl>(self))));
+          detail::throw_bad_result_access_with(base::_error(std::forward<Impl>(self)));
         }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));  // NOLINT
+        detail::throw_bad_result_access("no value");
       }
     }
-    template <class Impl> static constexpr void wide_error_check(Impl &&self)
+    template <class Impl> OUTCOME_OBSERVER_INLINE static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error"));  // NOLINT
+        detail::throw_bad_result_access("no error");
       }
     }
   };
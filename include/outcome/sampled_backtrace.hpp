@@ -0,0 +1,372 @@
+/* Sampled backtrace capture on result failure
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_SAMPLED_BACKTRACE_HPP
+#define OUTCOME_SAMPLED_BACKTRACE_HPP
+
+#include "error_trace.hpp"
+#include "payload_table.hpp"
+
+#include <cstdlib>  // for free
+#include <unordered_map>
+
+#ifdef __ANDROID__
+#define OUTCOME_DISABLE_EXECINFO
+#endif
+
+#ifndef OUTCOME_DISABLE_EXECINFO
+#ifdef _WIN32
+#include "quickcpplib/execinfo_win64.h"
+#else
+#include <execinfo.h>
+#endif
+#endif  // OUTCOME_DISABLE_EXECINFO
+
+//! The maximum number of frames captured per sampled failure.
+#ifndef OUTCOME_SAMPLED_BACKTRACE_DEPTH
+#define OUTCOME_SAMPLED_BACKTRACE_DEPTH 16
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+namespace backtrace_sampling
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  raw_backtrace. Potential doc page: NOT FOUND
+*/
+  struct raw_backtrace
+  {
+    void *frames[OUTCOME_SAMPLED_BACKTRACE_DEPTH];
+    uint16_t count;
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type alias  table. Potential doc page: NOT FOUND
+*/
+  using table = payload_table<raw_backtrace>;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  config. Potential doc page: NOT FOUND
+*/
+  struct config
+  {
+    uint32_t sample_one_in{64};               // Consider one failure in this many per thread
+    uint32_t category_per_second{100};        // Sustained captures per second per error category, zero for no limit
+    uint32_t category_burst{10};              // Captures per error category permitted in a burst
+    uint32_t site_interval_microseconds{1000};  // Minimum interval between captures from the same site
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  statistics. Potential doc page: NOT FOUND
+*/
+  struct statistics
+  {
+    uint64_t sampled{0};             // Failures which passed the 1-in-N sampler
+    uint64_t captured{0};            // Failures for which a backtrace was captured
+    uint64_t category_throttled{0};  // Sampled failures dropped by their category's token bucket
+    uint64_t site_throttled{0};      // Sampled failures dropped by their site's throttle
+  };
+
+  namespace detail
+  {
+    static constexpr size_t category_buckets = 64;
+    static constexpr size_t site_buckets = 1024;
+
+    struct state_t
+    {
+      std::atomic<uint32_t> sample_one_in{64};
+      std::atomic<int64_t> category_interval_ns{10000000};
+      std::atomic<int64_t> category_tolerance_ns{90000000};
+      std::atomic<int64_t> site_interval_ns{1000000};
+      // Generic cell rate algorithm: each bucket is the theoretical arrival time of the next capture
+      std::atomic<int64_t> category_tat[category_buckets];
+      std::atomic<int64_t> site_next[site_buckets];
+      std::atomic<uint64_t> sampled{0}, captured{0}, category_throttled{0}, site_throttled{0};
+      state_t() noexcept
+      {
+        for(auto &i : category_tat)
+        {
+          i.store(0, std::memory_order_relaxed);
+        }
+        for(auto &i : site_next)
+        {
+          i.store(0, std::memory_order_relaxed);
+        }
+      }
+    };
+    inline state_t &state() noexcept
+    {
+      static state_t v;
+      return v;
+    }
+
+    inline size_t hash_pointer(const void *p, size_t buckets) noexcept
+    {
+      // Fibonacci hashing, discarding alignment bits
+      return static_cast<size_t>((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p)) * 0x9E3779B97F4A7C15ULL) >> 40) & (buckets - 1);  // NOLINT
+    }
+
+    inline int64_t now_ns() noexcept
+    {
+      return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    template <class E> inline auto category_of(const E &e, OUTCOME_V2_NAMESPACE::detail::priority<1> /*unused*/) noexcept -> decltype(&e.category())
+    {
+      return &e.category();
+    }
+    template <class E> inline const void *category_of(const E & /*unused*/, OUTCOME_V2_NAMESPACE::detail::priority<0> /*unused*/) noexcept { return nullptr; }
+
+    inline bool admit_category(state_t &s, const void *category, int64_t now) noexcept
+    {
+      const int64_t interval = s.category_interval_ns.load(std::memory_order_relaxed);
+      if(interval == 0)
+      {
+        return true;  // no per category limit was configured
+      }
+      const int64_t tolerance = s.category_tolerance_ns.load(std::memory_order_relaxed);
+      auto &tat = s.category_tat[hash_pointer(category, category_buckets)];
+      int64_t t = tat.load(std::memory_order_relaxed);
+      for(;;)
+      {
+        if(t - now > tolerance)
+        {
+          return false;
+        }
+        const int64_t next = ((t > now) ? t : now) + interval;
+        if(tat.compare_exchange_weak(t, next, std::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+    }
+
+    inline bool admit_site(state_t &s, const void *site, int64_t now) noexcept
+    {
+      auto &next = s.site_next[hash_pointer(site, site_buckets)];
+      int64_t t = next.load(std::memory_order_relaxed);
+      if(now < t)
+      {
+        return false;
+      }
+      return next.compare_exchange_strong(t, now + s.site_interval_ns.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline void configure(const config &c) noexcept
+  {
+    auto &s = detail::state();
+    // At most 1e9 ns times 2^32 - 1 captures, so the tolerance cannot overflow
+    const int64_t interval = (c.category_per_second > 0) ? (1000000000LL / c.category_per_second) : 0;
+    s.sample_one_in.store((c.sample_one_in > 0) ? c.sample_one_in : 1, std::memory_order_relaxed);
+    s.category_interval_ns.store(interval, std::memory_order_relaxed);
+    s.category_tolerance_ns.store((c.category_burst > 1) ? interval * (c.category_burst - 1) : 0, std::memory_order_relaxed);
+    s.site_interval_ns.store(static_cast<int64_t>(c.site_interval_microseconds) * 1000, std::memory_order_relaxed);
+    for(auto &i : s.category_tat)
+    {
+      i.store(0, std::memory_order_relaxed);
+    }
+    for(auto &i : s.site_next)
+    {
+      i.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline statistics current_statistics() noexcept
+  {
+    auto &s = detail::state();
+    statistics ret;
+    ret.sampled = s.sampled.load(std::memory_order_relaxed);
+    ret.captured = s.captured.load(std::memory_order_relaxed);
+    ret.category_throttled = s.category_throttled.load(std::memory_order_relaxed);
+    ret.site_throttled = s.site_throttled.load(std::memory_order_relaxed);
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline bool try_capture(raw_backtrace &out, const void *category, const void *site) noexcept
+  {
+    // The common case of not being sampled touches only a thread local counter
+    static thread_local uint32_t countdown = 0;
+    if(countdown > 1)
+    {
+      --countdown;
+      return false;
+    }
+    auto &s = detail::state();
+    countdown = s.sample_one_in.load(std::memory_order_relaxed);
+    s.sampled.fetch_add(1, std::memory_order_relaxed);
+    const int64_t now = detail::now_ns();
+    if(!detail::admit_site(s, site, now))
+    {
+      s.site_throttled.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    if(!detail::admit_category(s, category, now))
+    {
+      s.category_throttled.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+#ifndef OUTCOME_DISABLE_EXECINFO
+    out.count = static_cast<uint16_t>(::backtrace(out.frames, OUTCOME_SAMPLED_BACKTRACE_DEPTH));  // NOLINT
+#else
+    out.frames[0] = const_cast<void *>(site);  // NOLINT
+    out.count = 1;
+#endif
+    s.captured.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  symbolizer. Potential doc page: NOT FOUND
+
+Resolves the raw addresses of many backtraces in one batch, intended to be run from a background
+thread or offline, never from the failure path.
+*/
+  class symbolizer
+  {
+    std::vector<void *> _pending;
+    std::unordered_map<void *, std::string> _names;
+
+  public:
+    //! Queues the addresses of a backtrace for resolution
+    void add(const raw_backtrace &bt)
+    {
+      for(uint16_t n = 0; n < bt.count; n++)
+      {
+        if(_names.find(bt.frames[n]) == _names.end())
+        {
+          _names.emplace(bt.frames[n], std::string());
+          _pending.push_back(bt.frames[n]);
+        }
+      }
+    }
+    //! Resolves all queued addresses, returning how many were resolved
+    size_t resolve()
+    {
+      if(_pending.empty())
+      {
+        return 0;
+      }
+#ifndef OUTCOME_DISABLE_EXECINFO
+      char **symbols = ::backtrace_symbols(_pending.data(), static_cast<int>(_pending.size()));  // NOLINT
+      if(symbols != nullptr)
+      {
+        for(size_t n = 0; n < _pending.size(); n++)
+        {
+          _names[_pending[n]] = symbols[n];  // NOLINT
+        }
+        free(symbols);  // NOLINT
+      }
+      else
+#endif
+      {
+        for(void *addr : _pending)
+        {
+          char buffer[32];
+          snprintf(buffer, sizeof(buffer), "%p", addr);  // NOLINT
+          _names[addr] = buffer;
+        }
+      }
+      const size_t ret = _pending.size();
+      _pending.clear();
+      return ret;
+    }
+    //! Returns the resolved name of an address, or null if not resolved yet
+    const std::string *lookup(void *addr) const
+    {
+      auto it = _names.find(addr);
+      return (it != _names.end() && !it->second.empty()) ? &it->second : nullptr;
+    }
+    //! Writes a resolved backtrace, one frame per line
+    std::ostream &write(std::ostream &s, const raw_backtrace &bt) const
+    {
+      for(uint16_t n = 0; n < bt.count; n++)
+      {
+        const std::string *name = lookup(bt.frames[n]);
+        if(name != nullptr)
+        {
+          s << "  " << *name << "\n";
+        }
+        else
+        {
+          s << "  " << bt.frames[n] << "\n";
+        }
+      }
+      return s;
+    }
+  };
+}  // namespace backtrace_sampling
+
+namespace policy
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class Base> sampled_backtrace. Potential doc page: NOT FOUND
+*/
+  template <class Base> struct sampled_backtrace : OUTCOME_V2_NAMESPACE::detail::failure_hooks<sampled_backtrace<Base>, Base>
+  {
+  private:
+    friend OUTCOME_V2_NAMESPACE::detail::failure_hooks<sampled_backtrace<Base>, Base>;
+
+    template <class T> static void _capture(T *inst, const void *category, const void *site) noexcept
+    {
+      backtrace_sampling::raw_backtrace bt;
+      if(backtrace_sampling::try_capture(bt, category, site))
+      {
+        backtrace_sampling::table::attach(inst, bt);
+      }
+    }
+    template <class T> OUTCOME_FORCEINLINE static const void *_category(T *inst, std::true_type /*has error type*/) noexcept
+    {
+      return backtrace_sampling::detail::category_of(base::_error(*inst), OUTCOME_V2_NAMESPACE::detail::priority<1>());
+    }
+    template <class T> OUTCOME_FORCEINLINE static const void *_category(T * /*unused*/, std::false_type /*has error type*/) noexcept { return nullptr; }
+    template <class T> OUTCOME_FORCEINLINE static void _on_construction(T *inst, const void *site) noexcept
+    {
+      if(base::_has_error(*inst))
+      {
+        _capture(inst, _category(inst, std::integral_constant<bool, !std::is_void<typename T::error_type>::value>()), site);
+      }
+      else if(base::_has_exception(*inst))
+      {
+        _capture(inst, nullptr, site);
+      }
+    }
+  };
+}  // namespace policy
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
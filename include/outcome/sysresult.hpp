@@ -0,0 +1,147 @@
+/* A result which packs an errno into its value, as the kernel's syscall convention does
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+File Created: Oct 2024
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_SYSRESULT_HPP
+#define OUTCOME_SYSRESULT_HPP
+
+#include "std_result.hpp"
+
+#include <cerrno>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class T> packed_errno. Potential doc page: `packed_errno<T>`
+*/
+template <class T> class packed_errno
+{
+  static_assert(std::is_integral<T>::value && std::is_signed<T>::value, "packed_errno<T> requires T to be a signed integral type");
+
+  // The negated errno. Within a sysresult, which always keeps its word here, this is the value if it is not negative.
+  T _word;
+
+  template <class, class> friend struct detail::value_storage_trivial;
+
+public:
+  //! Constructs from an errno, which must be positive, as zero or less would read as a value.
+  constexpr explicit packed_errno(int errcode) noexcept
+      : _word(static_cast<T>(-errcode))
+  {
+    if(errcode <= 0)
+    {
+      detail::packed_errno_misread();
+    }
+  }
+  //! Implicit construction from a `std::errc`.
+  constexpr packed_errno(std::errc errcode) noexcept  // NOLINT
+      : packed_errno(static_cast<int>(errcode))
+  {
+  }
+  //! Implicit conversion from a `packed_errno` of another width.
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_same<U, T>::value))
+  constexpr packed_errno(packed_errno<U> o) noexcept  // NOLINT
+      : _word(static_cast<T>(-o.value()))
+  {
+  }
+  //! Adopts the word returned by a syscall as is, used by `make_sysresult()`.
+  constexpr packed_errno(detail::packed_errno_raw_tag /*unused*/, T word) noexcept
+      : _word(word)
+  {
+  }
+
+  //! The errno.
+  constexpr int value() const noexcept { return static_cast<int>(-_word); }
+  //! The errno as a `std::error_code` in the generic category.
+  std::error_code to_error_code() const noexcept { return {value(), std::generic_category()}; }
+
+  friend constexpr bool operator==(const packed_errno &a, const packed_errno &b) noexcept { return a._word == b._word; }
+  friend constexpr bool operator!=(const packed_errno &a, const packed_errno &b) noexcept { return a._word != b._word; }
+};
+
+//! ADL discovered, makes `trait::is_error_code_available<packed_errno<T>>` true, and so `result<T>` explicitly constructible from `sysresult<T>`.
+template <class T> inline std::error_code make_error_code(packed_errno<T> e) noexcept
+{
+  return e.to_error_code();
+}
+
+//! ADL discovered, used by the `error_code_throw_as_system_error` policy.
+template <class T> inline void outcome_throw_as_system_error_with_payload(const packed_errno<T> &error)
+{
+  OUTCOME_THROW_EXCEPTION(std::system_error(error.to_error_code()));  // NOLINT
+}
+
+#if defined(SYSTEM_ERROR2_NAMESPACE) && !defined(SYSTEM_ERROR2_NOT_POSIX)
+//! ADL discovered, makes `experimental::status_result<T>` explicitly constructible from `sysresult<T>` if `experimental/status_result.hpp` is included first.
+template <class T> inline SYSTEM_ERROR2_NAMESPACE::posix_code make_status_code(packed_errno<T> e) noexcept
+{
+  return SYSTEM_ERROR2_NAMESPACE::posix_code(e.value());
+}
+#endif
+
+namespace trait
+{
+  namespace detail
+  {
+    template <class T> struct _is_error_code_available<packed_errno<T>>
+    {
+      // Shortcut this for lower build impact
+      static constexpr bool value = true;
+      using type = std::error_code;
+    };
+  }  // namespace detail
+
+  // packed_errno is an error type
+  template <class T> struct is_error_type<packed_errno<T>>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace trait
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <class T> sysresult. Potential doc page: `sysresult<T>`
+*/
+template <class T> using sysresult = basic_result<T, packed_errno<T>, policy::default_policy<T, packed_errno<T>, void>>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T> constexpr inline sysresult<T> make_sysresult(T ret) noexcept
+{
+  // A raw syscall returns the negated errno, which is already the layout of sysresult
+  return (ret < 0) ? sysresult<T>(in_place_type<packed_errno<T>>, detail::packed_errno_raw_tag(), ret) : sysresult<T>(in_place_type<T>, ret);
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T> inline sysresult<T> make_sysresult_from_errno(T ret) noexcept
+{
+  // libc returns -1 and sets errno
+  return (ret < 0) ? sysresult<T>(in_place_type<packed_errno<T>>, errno) : sysresult<T>(in_place_type<T>, ret);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -34,8 +34,8 @@ namespace trait
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-  template <class R>                                                             //
-  static constexpr bool type_can_be_used_in_basic_result =                       //
+  template <class R>                                                                                 //
+  OUTCOME_VARIABLE_TEMPLATE_LINKAGE constexpr bool type_can_be_used_in_basic_result =                //
   (!std::is_reference<R>::value                                                  //
    && !OUTCOME_V2_NAMESPACE::detail::is_in_place_type_t<std::decay_t<R>>::value  //
    && !is_success_type<R>                                                        //
@@ -53,6 +53,15 @@ type definition  is_error_type. Potential doc page: NOT FOUND
     static constexpr bool value = false;
   };
 
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  is_trivially_relocatable. Potential doc page: NOT FOUND
+*/
+  template <class T> struct is_trivially_relocatable
+  {
+    // Moving then destroying the source may be done by copying the bytes and forgetting the source
+    static constexpr bool value = OUTCOME_IS_TRIVIALLY_RELOCATABLE(T) || std::is_trivially_copyable<T>::value || is_move_bitcopying<T>::value;
+  };
+
   /*! AWAITING HUGO JSON CONVERSION TOOL
 type definition  is_error_type. Potential doc page: NOT FOUND
 */
@@ -27,11 +27,15 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "config.hpp"
 
+#ifdef __cpp_exceptions
+#include "detail/exception_registry.hpp"
+#endif
+
 #include <exception>
 #include <string>
 #include <system_error>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 #ifdef __cpp_exceptions
 /*! AWAITING HUGO JSON CONVERSION TOOL 
@@ -43,6 +47,22 @@ inline std::error_code error_from_exception(std::exception_ptr &&ep = std::curre
   {
     return {};
   }
+#if OUTCOME_EXCEPTION_REGISTRY_RTTI
+  {
+    // Look up the thrown type in the registry if it can be inspected without rethrowing
+    std::error_code ec;
+    switch(detail::classify_exception(ep, ec))
+    {
+    case detail::exception_classification::matched:
+      ep = std::exception_ptr();
+      return ec;
+    case detail::exception_classification::not_matched:
+      return not_matched;
+    case detail::exception_classification::unknown:
+      break;
+    }
+  }
+#endif
   try
   {
     std::rethrow_exception(ep);
@@ -103,6 +123,24 @@ inline std::error_code error_from_exception(std::exception_ptr &&ep = std::curre
   return not_matched;
 }
 
+#if OUTCOME_EXCEPTION_REGISTRY_RTTI
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class E> inline bool register_exception_error_code(std::error_code ec) noexcept
+{
+  return detail::exception_registry_instance().add(typeid(E), nullptr, nullptr, ec);
+}
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class E> inline bool register_exception_error_code(std::error_code (*f)(const E &)) noexcept
+{
+  return detail::exception_registry_instance().add(typeid(E), &detail::exception_registry_invoke<E>,
+                                                   reinterpret_cast<detail::exception_registry_generic_function>(f), {});  // NOLINT
+}
+#endif
+
 /*! AWAITING HUGO JSON CONVERSION TOOL 
 SIGNATURE NOT RECOGNISED
 */
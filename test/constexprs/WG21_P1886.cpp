@@ -21,7 +21,8 @@ Distributed under the Boost Software License, Version 1.0.
           http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#include "../../single-header/outcome-experimental.hpp"
+#include "../../include/outcome/experimental/status_result.hpp"
+#include "../../include/outcome/try.hpp"
 
 struct obj
 {
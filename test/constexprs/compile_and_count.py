@@ -1,15 +1,24 @@
 #!/usr/bin/python3
 # File created by Tom Westerhout in May 2017
+#
+# Compiles each canned codegen sequence in this directory with every installed
+# compiler, counts the opcodes generated for test1() and everything it calls,
+# and fails if any count has grown past the baseline for that compiler version
+# stored in <compiler>.csv. Sequences without a baseline are listed at the end.
+# Run with --update-baselines to record the current counts as the baseline.
 
 import sys
 import os
+import re
+import shutil
+import argparse
 import subprocess
 
 import count_opcodes
 
 
 def _mk_f(format_string : str):
-    return lambda s1, s2 : format_string.format(s1, s2)
+    return lambda cxx, s1, s2, extra : format_string.format(cxx = cxx, src = s1, out = s2, extra = extra)
 
 def _mk_o(initial_ext: str, final_ext : str):
     return lambda s : s.replace("." + initial_ext, "." + final_ext)
@@ -21,20 +30,35 @@ _compilers_ = \
     , "nt"      : ["msvc"]  #, "msvc_clang"]
     }
 
+# Searched in order, so the unversioned default compiler is preferred
+_candidates_ = \
+    { "gcc"        : ["g++"] + ["g++-%d" % v for v in range(20, 8, -1)]
+    , "clang"      : ["clang++"] + ["clang++-%d" % v for v in range(25, 8, -1)]
+    , "msvc"       : ["cl"]
+    , "msvc_clang" : ["clang"]
+    }
+
 _compile_info_ = \
-    { "gcc"        : (_mk_f("g++-9 -std=c++17 -DNDEBUG -O3 -fno-stack-protector -fno-exceptions {} -o {}"), _mk_o("cpp", "out"))
-    , "clang"      : (_mk_f("clang++-9 -std=c++17 -DNDEBUG -O3 -fno-exceptions {} -o {}"), _mk_o("cpp", "out"))
-    , "msvc"       : (_mk_f("cl /std:c++17 /c /EHsc /DNDEBUG /O2 /GS- /GR /Gy /Zc:inline /MT "
-                           + "/D_UNICODE=1 /DUNICODE=1 {} /Fo{}"), _mk_o("cpp", "obj"))
-    , "msvc_clang" : (_mk_f("clang -std=c++17 -c -DNDEBUG -O3 -fno-exceptions "
-                           + "-D_UNICODE=1 -DUNICODE=1 {} -o {} -fms-compatibility-version=19"), _mk_o("cpp", "out"))
+    { "gcc"        : (_mk_f("{cxx} -std=c++17 -DNDEBUG -O3 -fno-stack-protector -fno-exceptions {extra} {src} -o {out}"), _mk_o("cpp", "out"))
+    , "clang"      : (_mk_f("{cxx} -std=c++17 -DNDEBUG -O3 -fno-exceptions {extra} {src} -o {out}"), _mk_o("cpp", "out"))
+    , "msvc"       : (_mk_f("{cxx} /std:c++17 /c /EHsc /DNDEBUG /O2 /GS- /GR /Gy /Zc:inline /MT "
+                           + "/D_UNICODE=1 /DUNICODE=1 {extra} {src} /Fo{out}"), _mk_o("cpp", "obj"))
+    , "msvc_clang" : (_mk_f("{cxx} -std=c++17 -c -DNDEBUG -O3 -fno-exceptions "
+                           + "-D_UNICODE=1 -DUNICODE=1 {extra} {src} -o {out} -fms-compatibility-version=19"), _mk_o("cpp", "out"))
+    }
+
+_include_flag_ = \
+    { "gcc"        : "-I{}"
+    , "clang"      : "-I{}"
+    , "msvc"       : "/I{}"
+    , "msvc_clang" : "-I{}"
     }
 
 _disassemble_info_ = \
-    { "gcc"        : (_mk_f("objdump -C -d {} > {}"), _mk_o("out", "gcc.S"))
-    , "clang"      : (_mk_f("objdump -C -d {} > {}"), _mk_o("out", "clang.S"))
-    , "msvc"       : (_mk_f("dumpbin /disasm {} > {}"), _mk_o("obj", "msvc.S"))
-    , "msvc_clang" : (_mk_f("dumpbin /disasm {} > {}"), _mk_o("out", "msvc_clang.S"))
+    { "gcc"        : (_mk_f("objdump -C -d {src} > {out}"), _mk_o("out", "gcc.S"))
+    , "clang"      : (_mk_f("objdump -C -d {src} > {out}"), _mk_o("out", "clang.S"))
+    , "msvc"       : (_mk_f("dumpbin /disasm {src} > {out}"), _mk_o("obj", "msvc.S"))
+    , "msvc_clang" : (_mk_f("dumpbin /disasm {src} > {out}"), _mk_o("out", "msvc_clang.S"))
     }
 
 _function_ = \
@@ -58,48 +82,95 @@ limits = {
 }
 
 
+srcdir = os.path.dirname(os.path.abspath(__file__))
+
+
+#
+# Finds the first installed candidate for compiler, unless one was
+# given on the command line.
+# On success: returns (path to compiler, version label e.g. gcc12)
+# On failure: returns None
+#
+def discover(compiler : str, given : dict):
+    if given:
+        if compiler not in given:
+            return None
+        cxx = given[compiler]
+    else:
+        cxx = None
+        for candidate in _candidates_[compiler]:
+            cxx = shutil.which(candidate)
+            if cxx is not None:
+                break
+        if cxx is None:
+            return None
+    if compiler.startswith("msvc"):
+        return cxx, compiler
+    try:
+        version = subprocess.check_output([cxx, "-dumpversion"],
+            stderr=subprocess.STDOUT).decode('utf-8').strip()
+    except (subprocess.CalledProcessError, OSError):
+        return None
+    return cxx, compiler + version.split('.')[0]
+
 
+#
+# Returns any extra flags a source requires of compiler, given by lines like
+#
+# // compile_and_count gcc: -std=c++20
+#
+def source_flags(src_file : str, compiler : str) -> str:
+    flags = []
+    with open(src_file, "rt") as ih:
+        for line in ih:
+            r = re.match(r"^// compile_and_count ([a-z_]+): (.*)$", line.rstrip())
+            if r and r.group(1) == compiler:
+                flags.append(r.group(2))
+    return ' '.join(flags)
 
 
 #
 # Tries to compiler src_file using compiler.
-# On success: returns name of the executable. 
+# On success: returns name of the executable.
 # On failure: returns None
 #
-def compile(src_file : str, compiler : str) -> str:
+def compile(src_file : str, compiler : str, cxx : str, includes : list, outdir : str) -> str:
     if src_file is None:
         return None
-    print("[*] Compiling '" + src_file + "' with " + compiler + "...", 
+    print("[*] Compiling '" + src_file + "' with " + cxx + "...",
         file=sys.stderr)
 
     command, output = _compile_info_[compiler]
+    out_file = os.path.join(outdir, output(os.path.basename(src_file)))
+    extra = ' '.join([_include_flag_[compiler].format('"' + i + '"') for i in includes])
+    extra += ' ' + source_flags(src_file, compiler)
     try:
-        subprocess.check_output(command(src_file, output(src_file)), 
+        subprocess.check_output(command(cxx, '"' + src_file + '"', '"' + out_file + '"', extra),
             stderr=subprocess.STDOUT, shell=True)
     except subprocess.CalledProcessError as e:
-        print("[-] Error while compiling: " + e.output.decode('utf-8'), 
+        print("[-] Error while compiling: " + e.output.decode('utf-8'),
             file=sys.stderr)
         return None
-    return output(src_file)
+    return out_file
 
 #
 # Tries to disassemble obj_file using a tool corresponding
 # to compiler. If disassembling suceeds, deletes the obj_file.
-# On success: returns name of the file with asm code. 
+# On success: returns name of the file with asm code.
 # On failure: returns None
 #
 def disassemble(obj_file : str, compiler : str) -> str:
     if obj_file is None:
         return None
-    print("[*] Disassembling '" + obj_file + "' with " + compiler + "...", 
+    print("[*] Disassembling '" + obj_file + "' with " + compiler + "...",
         file=sys.stderr)
 
     command, output = _disassemble_info_[compiler]
     try:
-        subprocess.check_output(command(obj_file, output(obj_file)), 
+        subprocess.check_output(command(None, obj_file, output(obj_file), ''),
             stderr=subprocess.STDOUT, shell=True)
     except subprocess.CalledProcessError as e:
-        print("[-] Error while dissasembling: " + e.output.decode('utf-8'), 
+        print("[-] Error while dissasembling: " + e.output.decode('utf-8'),
             file=sys.stderr)
         return None
 
@@ -111,68 +182,146 @@ def disassemble(obj_file : str, compiler : str) -> str:
     return output(obj_file)
 
 
-def test_single(outname : str, func : str, src_file : str, compiler : str, indent : int):
-    asm_file = disassemble(compile(src_file, compiler), compiler)
-    assert asm_file is not None 
+#
+# Reads the baseline counts for each version of compiler, stored as a header
+# row naming the tests, then a row of counts per version. An empty count means
+# that version has no baseline for that test.
+# Returns { 'gcc12' : { 'test name' : count, ... }, ... }
+#
+def read_baselines(compiler : str) -> dict:
+    baselines = {}
+    path = os.path.join(srcdir, compiler + ".csv")
+    if not os.path.exists(path):
+        return baselines
+    with open(path, "rt") as ih:
+        rows = [l.strip() for l in ih if len(l.strip()) > 0]
+    names = []
+    for row in rows:
+        cells = [c.strip('"') for c in row.split(',')]
+        if cells[0] == "Compiler":
+            names = cells[1:]
+            continue
+        baselines[cells[0]] = dict((n, int(c)) for n, c in zip(names, cells[1:]) if len(c) > 0)
+    return baselines
+
+
+#
+# Replaces the baseline of one compiler version, keeping those of the others,
+# and rewrites <compiler>.csv with a single header row.
+#
+def write_baselines(compiler : str, version : str, counts : dict):
+    baselines = read_baselines(compiler)
+    baselines[version] = counts
+    names = sorted(set(n for b in baselines.values() for n in b))
+    with open(os.path.join(srcdir, compiler + ".csv"), "wt") as csv_file:
+        csv_file.write(','.join(['"Compiler"'] + ['"' + n + '"' for n in names]) + '\n')
+        for v in baselines:
+            csv_file.write(','.join(['"' + v + '"'] + [str(baselines[v][n]) if n in baselines[v] else '' for n in names]) + '\n')
+
+
+def test_single(outname : str, func : str, src_file : str, compiler : str, cxx : str,
+    version : str, includes : list, outdir : str, baseline : dict, tolerance : float, indent : int):
+    test_name = os.path.basename(src_file).replace(".cpp", "")
+    xml_string = '  '*indent + '<testcase name="' + test_name + '.' + \
+        version + '">\n'
+
+    asm_file = disassemble(compile(src_file, compiler, cxx, includes, outdir), compiler)
+    if asm_file is None:
+        xml_string += '  '*(indent+1) + '<failure message="Failed to compile"/>\n' + \
+                      '  '*indent + '</testcase>\n'
+        return (test_name, -1, xml_string, "failed to compile")
 
-    test_name = src_file.replace(".cpp", "")
     count, opcodes = count_opcodes.count_opcodes(outname, asm_file, func)
-    if count == -1:
-        print("[-] No call to " + func + " found.", file=sys.stderr)
-        sys.exit(1)
     try:
         os.remove(asm_file)
     except OSError as e:
         print("[-] Error removing file: " + e.strerror)
-    
-    output = "<![CDATA[\n" + "\n".join(opcodes) + "\n]]>"
-    xml_string = '  '*indent + '<testcase name="' + test_name + '.' + \
-        compiler + '">\n'
+    if count == -1:
+        xml_string += '  '*(indent+1) + '<failure message="No ' + func + ' found"/>\n' + \
+                      '  '*indent + '</testcase>\n'
+        return (test_name, -1, xml_string, "no " + func + " found")
+
+    failure = None
     if test_name in limits and compiler in limits[test_name] and limits[test_name][compiler] < count:
-        xml_string += '  '*(indent+1) + '<failure message="Opcodes generated ' + \
-            str(count) + ' exceeds limit ' + str(limits[test_name][compiler]) + '"/>\n'
+        failure = 'Opcodes generated ' + str(count) + ' exceeds limit ' + str(limits[test_name][compiler])
+    elif test_name in baseline and count > baseline[test_name] * (1.0 + tolerance / 100.0):
+        failure = 'Opcodes generated ' + str(count) + ' exceeds baseline ' + str(baseline[test_name])
+    output = "<![CDATA[\n" + "\n".join(opcodes) + "\n]]>"
+    if failure is not None:
+        xml_string += '  '*(indent+1) + '<failure message="' + failure + '"/>\n'
     xml_string += '  '*(indent+2) + '<system-out>\n' + output + '\n' + \
                   '  '*(indent+2) + '</system-out>\n' + \
                   '  '*indent + '</testcase>\n'
 
-    return (test_name, count, xml_string)
+    return (test_name, count, xml_string, failure)
 
 
 def list_src_files():
-    return sorted(filter(lambda src_file: os.path.isfile(src_file), 
-           filter(lambda s: s.endswith(".cpp"), 
-               os.listdir())))
+    return sorted(filter(lambda src_file: os.path.isfile(src_file),
+           map(lambda s: os.path.join(srcdir, s),
+           filter(lambda s: s.endswith(".cpp"),
+               os.listdir(srcdir)))))
 
 
-def test_all(func : dict):
+def test_all(func : dict, args) -> int:
     xml_string = '<?xml version="1.0" encoding="UTF-8"?>\n' + \
                  '<testsuite name="constexpr">\n'
-    # holds (compiler, name, count) tuples
-    csv_data = []
-    for src_file in list_src_files():
-        print(src_file)
-        for compiler in _compilers_[os.name]:
-            name, count, xml_output = test_single(func[compiler][1],
-                func[compiler][0], src_file, compiler, 1)
-            csv_data.append((compiler, name, count))
+    given = dict(c.split('=', 1) for c in (args.compiler or []))
+    outdir = os.path.abspath(args.output_dir)
+    os.makedirs(outdir, exist_ok=True)
+    failures = 0
+    tested = 0
+    missing = []
+    for compiler in _compilers_[os.name]:
+        found = discover(compiler, given)
+        if found is None:
+            print("[*] No " + compiler + " found, skipping.", file=sys.stderr)
+            continue
+        cxx, version = found
+        baseline = read_baselines(compiler).get(version, {})
+        if not baseline:
+            print("[*] No baseline for " + version + ", counts will be reported only.", file=sys.stderr)
+        # holds (name, count) tuples
+        csv_data = []
+        for src_file in list_src_files():
+            name, count, xml_output, failure = test_single(func[compiler][1],
+                func[compiler][0], src_file, compiler, cxx, version, args.include_dir or [],
+                outdir, baseline, args.tolerance, 1)
+            tested += 1
+            csv_data.append((name, count))
             xml_string += xml_output
+            if failure is not None:
+                failures += 1
+                print("[-] " + name + " with " + version + ": " + failure, file=sys.stderr)
+            else:
+                print("[+] " + name + " with " + version + ": " + str(count) + " opcodes"
+                    + ((" (baseline " + str(baseline[name]) + ")") if name in baseline else " (NO BASELINE)"), file=sys.stderr)
+            if name not in baseline:
+                missing.append(name + " with " + version)
+
+        if args.update_baselines:
+            write_baselines(compiler, version, dict(t for t in csv_data if t[1] >= 0))
     xml_string += '</testsuite>'
 
-    with open("results." + os.name + ".xml", "wt") as xml_file:
+    with open(os.path.join(outdir, "results." + os.name + ".xml"), "wt") as xml_file:
         xml_file.write(xml_string)
 
-    for compiler in _compilers_[os.name]:
-        with open(compiler + ".csv", "a+t") as csv_file:
-            csv_file.write(','.join( 
-                map(lambda t: '"'+t[1]+'"', 
-                filter(lambda t: t[0] == compiler, 
-                    csv_data))))
-            csv_file.write('\n')
-            csv_file.write(','.join( 
-                map(lambda t: str(t[2]), 
-                filter(lambda t: t[0] == compiler, 
-                    csv_data))))
-            csv_file.write('\n')
-
-
-test_all(_function_)
+    if missing and not args.update_baselines:
+        print("[!] " + str(len(missing)) + " sequences have no baseline, so were not checked for regression:", file=sys.stderr)
+        for m in missing:
+            print("[!]     " + m, file=sys.stderr)
+
+    if tested == 0:
+        print("[-] No compilers found.", file=sys.stderr)
+        return 1
+    return 1 if failures > 0 and not args.update_baselines else 0
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Count the opcodes generated for canned codegen sequences, and fail on regression')
+    parser.add_argument('--compiler', action='append', help='Use only the compilers given as family=path, e.g. gcc=/usr/bin/g++-12')
+    parser.add_argument('--include-dir', action='append', help='Additional include directory, e.g. for quickcpplib')
+    parser.add_argument('--output-dir', default='.', help='Where to write the binaries, disassembly and results')
+    parser.add_argument('--tolerance', type=float, default=0.0, help='Percentage growth in opcodes permitted against the baseline')
+    parser.add_argument('--update-baselines', action='store_true', help='Record the counts as the baseline for each compiler version found')
+    sys.exit(test_all(_function_, parser.parse_args()))
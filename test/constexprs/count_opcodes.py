@@ -32,7 +32,8 @@ debug = False
 #   22:	c3                   	retq   
 
 def get_call_target_objdump(l):
-  r = re.match(r".*callq\s+[0-9a-f]+\s+<(.+)>$", l)
+  # Newer binutils no longer suffix call and ret with q
+  r = re.match(r".*\scallq?\s+[0-9a-f]+\s+<(.+)>$", l)
   if r:
     return r.group(1)
   return None
@@ -72,12 +73,12 @@ _is_instruction_ = \
     }
 
 _is_normal_instruction_ = \
-    { 'objdump' : lambda l: _is_instruction_['objdump'](l) and 'retq' not in l and 'nop' not in l
+    { 'objdump' : lambda l: _is_instruction_['objdump'](l) and re.search(r"\s(retq?|nop[wl]?)(\s|$)", l) is None
     , 'dumpbin' : lambda l: _is_instruction_['dumpbin'](l) and 'ret' not in l and 'nop' not in l
     }
 
 _is_call_instruction_ = \
-    { 'objdump' : lambda l: "callq" in l
+    { 'objdump' : lambda l: re.search(r"\scallq?\s", l) is not None
     , 'dumpbin' : lambda l: "call" in l
     }
 
@@ -146,6 +147,9 @@ def find_opcodes(name : str, functions : dict, file_type : str) -> tuple:
     if len(all_matches) > 1:
         print("[*] Matching functions: ", list(map(lambda t: t[0], 
             all_matches)), file=sys.stderr)
+        # Prefer the function itself over its clones, such as the parts of a coroutine
+        shortest = min(map(lambda t: len(t[0]), all_matches))
+        all_matches = list(filter(lambda t: len(t[0]) == shortest, all_matches))
     assert len(all_matches) == 1
     return all_matches[0]
 
@@ -0,0 +1,52 @@
+/* Canned codegen quality test sequences
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/compact_error_code.hpp"
+
+#ifdef __GNUC__
+#define WEAK __attribute__((weak))
+#else
+#define WEAK
+#endif
+
+using namespace OUTCOME_V2_NAMESPACE;
+extern result<int64_t, compact_error_code> unknown() WEAK;
+extern QUICKCPPLIB_NOINLINE result<int64_t, compact_error_code> test1()
+{
+  OUTCOME_TRY(auto a, unknown());
+  OUTCOME_TRY(auto b, unknown());
+  OUTCOME_TRY(auto c, unknown());
+  return a + b + c;
+}
+extern QUICKCPPLIB_NOINLINE void test2()
+{
+}
+
+int main(void)
+{
+  int ret=0;
+  if(test1()) ret=1;
+  test2();
+  return ret;
+}
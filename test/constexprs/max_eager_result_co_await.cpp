@@ -0,0 +1,53 @@
+/* Canned codegen quality test sequences
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+// compile_and_count gcc: -std=c++20
+// compile_and_count clang: -std=c++20
+// compile_and_count msvc: /std:c++latest
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/coroutine_support.hpp"
+
+#ifdef __GNUC__
+#define WEAK __attribute__((weak))
+#else
+#define WEAK
+#endif
+
+using namespace OUTCOME_V2_NAMESPACE;
+extern result<int> unknown() WEAK;
+extern QUICKCPPLIB_NOINLINE awaitables::eager<result<int>> test1()
+{
+  OUTCOME_CO_TRY(auto v, unknown());
+  co_return v + 1;
+}
+extern QUICKCPPLIB_NOINLINE void test2()
+{
+}
+
+int main(void)
+{
+  int ret=0;
+  if(test1().await_resume()) ret=1;
+  test2();
+  return ret;
+}
@@ -0,0 +1,138 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/boxed_error.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <thread>
+
+namespace boxed_error_test
+{
+  // A rich error, much larger than the value it accompanies
+  struct rich_error
+  {
+    std::error_code ec;
+    char context[48];
+    static int alive;
+
+    explicit rich_error(std::errc e, const char *msg = "")
+        : ec(make_error_code(e))
+    {
+      std::strncpy(context, msg, sizeof(context) - 1);
+      context[sizeof(context) - 1] = 0;
+      ++alive;
+    }
+    rich_error(const rich_error &o)
+        : ec(o.ec)
+    {
+      std::memcpy(context, o.context, sizeof(context));
+      ++alive;
+    }
+    ~rich_error() { --alive; }
+    friend bool operator==(const rich_error &a, const rich_error &b) noexcept { return a.ec == b.ec; }
+  };
+  int rich_error::alive;
+  inline std::error_code make_error_code(const rich_error &e) noexcept { return e.ec; }
+  inline void outcome_throw_as_system_error_with_payload(const rich_error &e) { OUTCOME_THROW_EXCEPTION(std::system_error(e.ec, e.context)); }
+}  // namespace boxed_error_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / boxed_error, "Tests that boxed_error keeps large errors out of results")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using boxed_error_test::rich_error;
+  using boxed_result = result<int, boxed_error<rich_error>>;
+  static_assert(sizeof(result<int, rich_error>) > sizeof(rich_error), "result<int, rich_error> is unexpectedly small");
+  static_assert(sizeof(boxed_result) <= 2 * sizeof(void *), "result<int, boxed_error<rich_error>> is not two words");
+  static_assert(std::is_same<boxed_result::no_value_policy_type, policy::error_code_throw_as_system_error<int, boxed_error<rich_error>, void>>::value,
+                "result<int, boxed_error<rich_error>> does not have the policy of result<int, rich_error>");
+  {
+    // Success allocates nothing
+    boxed_result a(5);
+    BOOST_CHECK(a.value() == 5);
+    BOOST_CHECK(rich_error::alive == 0);
+
+    // Failure boxes the error, and error() can be used as if it were the error
+    boxed_result b(rich_error(std::errc::invalid_argument, "parsing"));
+    BOOST_CHECK(rich_error::alive == 1);
+    BOOST_CHECK(b.has_error());
+    BOOST_CHECK(b.error()->ec == std::errc::invalid_argument);
+    const rich_error &e = b.error();
+    BOOST_CHECK(std::strcmp(e.context, "parsing") == 0);
+
+    // Moves take the box, copies box a copy
+    boxed_result c(std::move(b));
+    BOOST_CHECK(rich_error::alive == 1);
+    boxed_result d(c);
+    BOOST_CHECK(rich_error::alive == 2);
+    BOOST_CHECK(c.error() == d.error());
+    d = a;
+    BOOST_CHECK(rich_error::alive == 1);
+    BOOST_CHECK(d.value() == 5);
+
+    // Converts from and into the unboxed result
+    result<int, rich_error> f(rich_error(std::errc::io_error));
+    boxed_result g(f);
+    BOOST_CHECK(g.error()->ec == std::errc::io_error);
+
+    // TRY propagates the box without copying the error
+    auto h = [&]() -> boxed_result {
+      OUTCOME_TRY(auto &&v, a);
+      OUTCOME_TRY(std::move(c));
+      return v;
+    }();
+    BOOST_CHECK(h.error()->ec == std::errc::invalid_argument);
+#ifdef __cpp_exceptions
+    try
+    {
+      h.value();
+      BOOST_CHECK(false);
+    }
+    catch(const std::system_error &ex)
+    {
+      BOOST_CHECK(ex.code() == std::errc::invalid_argument);
+    }
+#endif
+  }
+  BOOST_CHECK(rich_error::alive == 0);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / boxed_error / thread_exit, "Tests that boxes freed after the thread's pool is destroyed go to the allocator")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using boxed_error_test::rich_error;
+  struct holder
+  {
+    boxed_error<rich_error> e;
+  };
+  std::thread([] {
+    // Constructed before the pool, so destroyed after it
+    static thread_local holder h;
+    h.e = boxed_error<rich_error>(rich_error(std::errc::owner_dead));
+    boxed_error<rich_error> a(rich_error(std::errc::timed_out));
+    BOOST_CHECK(rich_error::alive == 2);
+  }).join();
+  BOOST_CHECK(rich_error::alive == 0);
+}
@@ -0,0 +1,105 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/compact_error_code.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <future>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / compact_error_code, "Tests that compact_error_code round trips std::error_code and keeps result small")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using compact_result = result<int64_t, compact_error_code>;
+  static_assert(sizeof(compact_result) == 16, "result<int64_t, compact_error_code> is not sixteen bytes");
+  static_assert(std::is_trivially_copyable<compact_result>::value, "result<int64_t, compact_error_code> is not trivially copyable");
+  static_assert(trait::is_error_code_available<compact_error_code>::value, "compact_error_code does not have an error code available");
+  static_assert(std::is_same<compact_result::no_value_policy_type, policy::error_code_throw_as_system_error<int64_t, compact_error_code, void>>::value,
+                "result<int64_t, compact_error_code> does not default to throwing std::system_error");
+
+  // Value initialisation is a default constructed std::error_code
+  BOOST_CHECK(compact_error_code() == std::error_code());
+  BOOST_CHECK(!compact_error_code());
+
+  // Round trips through each of the well known categories
+  for(const std::error_code &ec : {std::make_error_code(std::errc::io_error), std::error_code(5, std::system_category()),
+                                   std::make_error_code(std::future_errc::no_state), std::make_error_code(std::io_errc::stream)})
+  {
+    const compact_error_code c(ec);
+    BOOST_CHECK(c == ec);
+    BOOST_CHECK(ec == c);
+    BOOST_CHECK(static_cast<std::error_code>(c) == ec);
+    BOOST_CHECK(&c.category() == &ec.category());
+    BOOST_CHECK(c.message() == ec.message());
+  }
+  BOOST_CHECK(compact_error_code(std::future_errc::no_state) == std::make_error_code(std::future_errc::no_state));
+  BOOST_CHECK(compact_error_code(std::make_error_code(std::errc::io_error)) != compact_error_code(std::make_error_code(std::errc::no_buffer_space)));
+  BOOST_CHECK(compact_error_code(std::make_error_code(std::errc::io_error)) == std::errc::io_error);
+
+  // Results construct from error enums and convert to std::error_code results
+  compact_result r(std::errc::invalid_argument);
+  BOOST_CHECK(r.has_error());
+  BOOST_CHECK(r.error() == std::errc::invalid_argument);
+  result<int64_t> s(r);
+  BOOST_CHECK(s.error() == std::errc::invalid_argument);
+  compact_result t(s);
+  BOOST_CHECK(t.error() == r.error());
+#ifdef __cpp_exceptions
+  try
+  {
+    r.value();
+    BOOST_CHECK(false);
+  }
+  catch(const std::system_error &e)
+  {
+    BOOST_CHECK(e.code() == std::errc::invalid_argument);
+  }
+#endif
+  r = 78;
+  BOOST_CHECK(r.value() == 78);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / compact_error_code / registry, "Tests that codes from many registered categories round trip and compare as an equivalence")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  struct category : std::error_category
+  {
+    const char *name() const noexcept override { return "many"; }
+    std::string message(int /*unused*/) const override { return "many"; }
+  };
+  // As many categories as the registry can hold alongside the well known ones, as registering more is fatal
+  static const category categories[OUTCOME_COMPACT_ERROR_CODE_CATEGORIES - 8];
+  for(const auto &c : categories)
+  {
+    const compact_error_code a(1, c);
+    const compact_error_code b(a);
+    BOOST_CHECK(&a.category() == &c);
+    BOOST_CHECK(a == a);
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a == std::error_code(1, c));
+    BOOST_CHECK(a != compact_error_code(2, c));
+  }
+  const result<int, compact_error_code> r(compact_error_code(1, categories[1])), s(r);
+  BOOST_CHECK(r == s);
+}
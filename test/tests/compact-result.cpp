@@ -0,0 +1,84 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/compact_result.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstdint>
+#include <string>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / compact, "Tests that compact_result has a one byte status and no spare storage")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(sizeof(compact_result<uint16_t, uint8_t>) == 4, "compact_result<uint16_t, uint8_t> is not 4 bytes");
+  static_assert(sizeof(compact_result<void, uint8_t>) == 2, "compact_result<void, uint8_t> is not 2 bytes");
+  static_assert(std::is_trivially_copyable<compact_result<uint16_t, uint8_t>>::value, "compact_result<uint16_t, uint8_t> is not trivially copyable");
+  // The default is unchanged, and a four byte aligned value leaves nothing to save
+  static_assert(sizeof(result<uint16_t, uint8_t>) == 6, "result<uint16_t, uint8_t> is not 6 bytes");
+  static_assert(sizeof(result<uint32_t, uint16_t>) == sizeof(compact_result<uint32_t, uint16_t>), "compact_result<uint32_t, uint16_t> changed size");
+  static_assert(sizeof(result<std::string, int>) == sizeof(compact_result<std::string, int>), "compact_result<std::string, int> changed size");
+  static_assert(sizeof(result<int &, void>) == sizeof(compact_result<int &, void>), "compact_result<int &, void> changed size");
+
+  // Observers and assignment
+  constexpr compact_result<uint16_t, uint8_t> c(in_place_type<uint16_t>, uint16_t(5));
+  static_assert(c.assume_value() == 5, "compact_result is not usable in constant expressions");
+  compact_result<uint16_t, uint8_t> a(in_place_type<uint16_t>, uint16_t(5)), b(in_place_type<uint8_t>, uint8_t(78));
+  BOOST_CHECK(a.has_value());
+  BOOST_CHECK(a.assume_value() == 5);
+  BOOST_CHECK(b.has_error());
+  BOOST_CHECK(!b.has_value());
+  BOOST_CHECK(b.assume_error() == 78);
+  a.swap(b);
+  BOOST_CHECK(a.has_error());
+  BOOST_CHECK(b.assume_value() == 5);
+  a = b;
+  BOOST_CHECK(a.assume_value() == 5);
+
+  // Spare storage reads as zero, and writes are discarded
+  BOOST_CHECK(hooks::spare_storage(&a) == 0);
+  hooks::set_spare_storage(&a, 78);
+  BOOST_CHECK(hooks::spare_storage(&a) == 0);
+  BOOST_CHECK(a.assume_value() == 5);
+
+  // Conversion is from results with any policy
+  compact_result<int> e(std::errc::invalid_argument);
+  BOOST_CHECK(e.error() == std::errc::invalid_argument);
+  result<int> f(std::errc::invalid_argument);
+  compact_result<long> g(f);
+  BOOST_CHECK(g.has_error());
+  BOOST_CHECK(g.error() == std::errc::invalid_argument);
+  compact_result<long> h(result<int>(5));
+  BOOST_CHECK(h.value() == 5);
+  compact_result<void> v{result<void>(success())};
+  BOOST_CHECK(v.has_value());
+  compact_result<long> i(compact_result<int>(6));
+  BOOST_CHECK(i.value() == 6);
+  i.emplace_error(std::make_error_code(std::errc::io_error));
+  BOOST_CHECK(i.error() == std::errc::io_error);
+
+  // Storage of non-trivial types is as usual
+  compact_result<std::string> s("hello");
+  BOOST_CHECK(s.value() == "hello");
+}
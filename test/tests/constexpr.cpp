@@ -24,6 +24,9 @@ Distributed under the Boost Software License, Version 1.0.
 #include "../../include/outcome.hpp"
 #include "quickcpplib/boost/test/unit_test.hpp"
 
+#include <string>
+#include <vector>
+
 #if __cplusplus >= 201700 || _HAS_CXX17
 // Match LiteralType, even on C++ 17 and later
 template <class T> struct is_literal_type
@@ -108,4 +111,46 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / constexpr, "Tests that outcome wo
     (void) g4;
     (void) g6;
   }
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_string) && defined(__cpp_lib_constexpr_vector)
+  {
+    // Test results of non-trivial types work in constant evaluation
+    static_assert(
+    [] {
+      result<std::string> a("niall"), b(a);
+      result<std::string> c(std::move(b));
+      a = c;
+      a = std::move(c);
+      result<std::string> d(in_place_type<std::string>, 3, 'x');
+      a.swap(d);
+      return a.value() == "xxx" && d.value() == "niall";
+    }(),
+    "result<std::string> does not work in constant evaluation");
+    static_assert(
+    [] {
+      result<std::vector<int>> a(in_place_type<std::vector<int>>, {1, 2, 3});
+      auto b = a;
+      b.value().push_back(4);
+      a = b;
+      return a.value().size() == 4 && a.value()[3] == 4;
+    }(),
+    "result<std::vector<int>> does not work in constant evaluation");
+    // Swapping and assigning between value and error, and converting
+    static_assert(
+    [] {
+      result<std::string, int> a("niall"), b(5);
+      a.swap(b);
+      if(!a.has_error() || a.assume_error() != 5 || b.assume_value() != "niall")
+      {
+        return false;
+      }
+      a = b;
+      b = result<std::string, int>(6);
+      result<std::string, long> c(b);
+      result<std::vector<int>, int> d(in_place_type<std::vector<int>>, 2, 7), e(8);
+      d.swap(e);
+      return a.assume_value() == "niall" && c.assume_error() == 6 && d.assume_error() == 8 && e.assume_value().size() == 2;
+    }(),
+    "result<std::string, int> does not work in constant evaluation");
+  }
+#endif
 }
@@ -0,0 +1,163 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace emplace_test
+{
+  struct counted
+  {
+    static int constructed, destroyed, assigned;
+    int v;
+    counted(int _v = 0)  // NOLINT
+        : v(_v)
+    {
+      ++constructed;
+    }
+    counted(const counted &o)
+        : v(o.v)
+    {
+      ++constructed;
+    }
+    counted &operator=(const counted &o)
+    {
+      v = o.v;
+      ++assigned;
+      return *this;
+    }
+    ~counted() { ++destroyed; }
+  };
+  int counted::constructed, counted::destroyed, counted::assigned;
+
+  struct thrower
+  {
+    thrower() = default;
+    explicit thrower(int /*unused*/) { throw std::runtime_error("construction failed"); }
+  };
+}  // namespace emplace_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / emplace, "Tests that emplace_value(), emplace_error() and reset_to_value() reuse storage")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace emplace_test;
+
+  // Emplacing into a value assigns to it, so it keeps its capacity
+  {
+    result<std::vector<int>> r(in_place_type<std::vector<int>>, 1000, 5);
+    const int *buffer = r.value().data();
+    std::vector<int> rows{1, 2, 3};
+    std::vector<int> &v = r.emplace_value(rows);
+    BOOST_CHECK(&v == &r.value());
+    BOOST_CHECK(v.size() == 3);
+    BOOST_CHECK(v.data() == buffer);
+    BOOST_CHECK(v.capacity() >= 1000);
+    r.emplace_value({4, 5});
+    BOOST_CHECK(r.value().size() == 2);
+    BOOST_CHECK(r.value().data() == buffer);
+
+    // reset_to_value() keeps the value as it is
+    r.reset_to_value().clear();
+    BOOST_CHECK(r.value().empty());
+    BOOST_CHECK(r.value().data() == buffer);
+
+    // Switching to an error and back constructs afresh
+    r.emplace_error(std::make_error_code(std::errc::io_error));
+    BOOST_CHECK(r.has_error());
+    BOOST_CHECK(r.error() == std::errc::io_error);
+    r.emplace_error(std::make_error_code(std::errc::invalid_argument));
+    BOOST_CHECK(r.error() == std::errc::invalid_argument);
+    r.reset_to_value();
+    BOOST_CHECK(r.has_value());
+    BOOST_CHECK(r.value().empty());
+    r.emplace_value(3, 7);
+    BOOST_CHECK(r.value() == std::vector<int>({7, 7, 7}));
+  }
+
+  // Only what has to be is destroyed
+  {
+    counted::constructed = counted::destroyed = counted::assigned = 0;
+    result<counted, std::string> r(5);
+    r.emplace_value(counted(6));
+    BOOST_CHECK(r.value().v == 6);
+    BOOST_CHECK(counted::assigned == 1);
+    BOOST_CHECK(counted::constructed == 2);  // the value, and the temporary
+    BOOST_CHECK(counted::destroyed == 1);
+    r.emplace_value(7);
+    BOOST_CHECK(r.value().v == 7);
+    BOOST_CHECK(counted::assigned == 2);
+    r.emplace_error("failed");
+    BOOST_CHECK(counted::destroyed == counted::constructed);
+    BOOST_CHECK(r.error() == "failed");
+    r.emplace_value(8);
+    BOOST_CHECK(r.value().v == 8);
+    BOOST_CHECK(counted::constructed == counted::destroyed + 1);
+  }
+
+  // Trivial storage, and void
+  {
+    result<int> r(5);
+    BOOST_CHECK(r.emplace_value(6) == 6);
+    r.emplace_error(std::make_error_code(std::errc::io_error));
+    BOOST_CHECK(r.error() == std::errc::io_error);
+    BOOST_CHECK(r.reset_to_value() == 0);
+    result<void> v(std::errc::io_error);
+    v.emplace_value();
+    BOOST_CHECK(v.has_value());
+    v.emplace_error(std::make_error_code(std::errc::io_error));
+    BOOST_CHECK(v.has_error());
+    v.reset_to_value();
+    BOOST_CHECK(v.has_value());
+  }
+
+  // References rebind, and the error of result<T &, void> is a null pointer
+  {
+    int x = 1, y = 2;
+    result<int &, void> r(x);
+    r.emplace_value(y);
+    BOOST_CHECK(&r.value() == &y);
+    BOOST_CHECK(x == 1);
+    r.emplace_error();
+    BOOST_CHECK(r.has_error());
+    r.emplace_value(x);
+    BOOST_CHECK(&r.value() == &x);
+  }
+
+#ifdef __cpp_exceptions
+  // If constructing the replacement throws, neither is held and consistency is lost
+  {
+    result<thrower, std::string> r(in_place_type<std::string>, "failed");
+    BOOST_CHECK_THROW(r.emplace_value(1), std::runtime_error);
+    BOOST_CHECK(!r.has_value());
+    BOOST_CHECK(!r.has_error());
+    BOOST_CHECK(r.has_lost_consistency());
+    r.emplace_value();
+    BOOST_CHECK(r.has_value());
+    BOOST_CHECK(!r.has_lost_consistency());
+  }
+#endif
+}
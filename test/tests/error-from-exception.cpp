@@ -0,0 +1,116 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/utils.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#ifdef __cpp_exceptions
+namespace error_from_exception_test
+{
+  struct derived_runtime_error : std::runtime_error
+  {
+    derived_runtime_error()
+        : std::runtime_error("derived")
+    {
+    }
+  };
+  struct mixin
+  {
+    int x{0};
+  };
+  struct multiple_runtime_error : mixin, std::runtime_error
+  {
+    multiple_runtime_error()
+        : std::runtime_error("multiple")
+    {
+    }
+  };
+  struct custom_error
+  {
+    int code;
+  };
+  struct unregistered_error
+  {
+  };
+  inline std::error_code custom_error_code(const custom_error &e) { return {e.code, std::generic_category()}; }
+
+  template <class E> std::error_code classify(E &&e)
+  {
+    auto ep = std::make_exception_ptr(static_cast<E &&>(e));
+    auto ec = OUTCOME_V2_NAMESPACE::error_from_exception(std::move(ep), std::make_error_code(std::errc::not_supported));
+    // A match consumes the exception_ptr, no match leaves it intact
+    BOOST_CHECK(static_cast<bool>(ep) == (ec == std::errc::not_supported));
+    return ec;
+  }
+}  // namespace error_from_exception_test
+#endif
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_from_exception, "Tests that error_from_exception maps exceptions to their error codes")
+{
+#ifdef __cpp_exceptions
+  using namespace error_from_exception_test;
+  BOOST_CHECK(classify(std::invalid_argument("")) == std::errc::invalid_argument);
+  BOOST_CHECK(classify(std::domain_error("")) == std::errc::argument_out_of_domain);
+  BOOST_CHECK(classify(std::length_error("")) == std::errc::argument_list_too_long);
+  BOOST_CHECK(classify(std::out_of_range("")) == std::errc::result_out_of_range);
+  BOOST_CHECK(classify(std::logic_error("")) == std::errc::invalid_argument);
+  BOOST_CHECK(classify(std::system_error(std::make_error_code(std::errc::broken_pipe))) == std::errc::broken_pipe);
+  BOOST_CHECK(classify(std::overflow_error("")) == std::errc::value_too_large);
+  BOOST_CHECK(classify(std::range_error("")) == std::errc::result_out_of_range);
+  BOOST_CHECK(classify(std::runtime_error("")) == std::errc::resource_unavailable_try_again);
+  BOOST_CHECK(classify(std::bad_alloc()) == std::errc::not_enough_memory);
+  // Types derived from the standard ones map as their base would
+  BOOST_CHECK(classify(derived_runtime_error()) == std::errc::resource_unavailable_try_again);
+  BOOST_CHECK(classify(multiple_runtime_error()) == std::errc::resource_unavailable_try_again);
+  BOOST_CHECK(classify(std::ios_base::failure("")) == std::ios_base::failure("").code());
+  // Unrelated types do not match
+  BOOST_CHECK(classify(5) == std::errc::not_supported);
+  BOOST_CHECK(classify(unregistered_error()) == std::errc::not_supported);
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::error_from_exception(std::exception_ptr()) == std::error_code());
+
+  // Within a catch clause, the current exception is classified by default
+  try
+  {
+    throw std::domain_error("");
+  }
+  catch(...)
+  {
+    BOOST_CHECK(OUTCOME_V2_NAMESPACE::error_from_exception() == std::errc::argument_out_of_domain);
+  }
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_from_exception / registry, "Tests that users can register their own exception types")
+{
+#if defined(__cpp_exceptions) && OUTCOME_EXCEPTION_REGISTRY_RTTI
+  using namespace error_from_exception_test;
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::register_exception_error_code<custom_error>(custom_error_code));
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::register_exception_error_code<unregistered_error>(std::make_error_code(std::errc::io_error)));
+#if OUTCOME_EXCEPTION_REGISTRY_ITANIUM
+  // User registrations are only consulted where the thrown type can be inspected without rethrowing
+  BOOST_CHECK(classify(custom_error{EACCES}) == std::errc::permission_denied);
+  BOOST_CHECK(classify(unregistered_error()) == std::errc::io_error);
+#endif
+#endif
+}
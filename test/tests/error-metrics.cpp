@@ -0,0 +1,228 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/error_metrics.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <new>
+#include <sstream>
+#include <thread>
+
+namespace error_metrics_test
+{
+  template <class T> using result = OUTCOME_V2_NAMESPACE::result<T, std::error_code, OUTCOME_V2_NAMESPACE::policy::error_metrics<OUTCOME_V2_NAMESPACE::policy::default_policy<T, std::error_code, void>>>;
+  template <class T> using outcome = OUTCOME_V2_NAMESPACE::outcome<T, std::error_code, std::exception_ptr, OUTCOME_V2_NAMESPACE::policy::error_metrics<OUTCOME_V2_NAMESPACE::policy::default_policy<T, std::error_code, std::exception_ptr>>>;
+
+  // Set to make the nothrow operator new on this thread fail
+  static thread_local bool fail_nothrow_new;
+
+  inline uint64_t count(const std::vector<OUTCOME_V2_NAMESPACE::metrics::sample> &samples, const std::string &domain, int64_t value)
+  {
+    for(const auto &s : samples)
+    {
+      if(s.domain == domain && s.value == value)
+      {
+        return s.count;
+      }
+    }
+    return 0;
+  }
+}  // namespace error_metrics_test
+
+void *operator new(std::size_t size, const std::nothrow_t & /*unused*/) noexcept
+{
+  if(error_metrics_test::fail_nothrow_new)
+  {
+    return nullptr;
+  }
+  try
+  {
+    return ::operator new(size);
+  }
+  catch(...)
+  {
+    return nullptr;
+  }
+}
+#ifdef __cpp_aligned_new
+void *operator new(std::size_t size, std::align_val_t align, const std::nothrow_t & /*unused*/) noexcept
+{
+  if(error_metrics_test::fail_nothrow_new)
+  {
+    return nullptr;
+  }
+  try
+  {
+    return ::operator new(size, align);
+  }
+  catch(...)
+  {
+    return nullptr;
+  }
+}
+#endif
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_metrics / counts, "Tests that failures are counted by category and value")
+{
+  using namespace error_metrics_test;
+  using OUTCOME_V2_NAMESPACE::metrics::snapshot;
+  const std::string generic = std::generic_category().name();
+  const auto reset = static_cast<int>(std::errc::connection_reset);
+  const auto refused = static_cast<int>(std::errc::connection_refused);
+  const auto before_reset = count(snapshot(), generic, reset);
+  const auto before_refused = count(snapshot(), generic, refused);
+  {
+    result<int> a(5);
+    BOOST_CHECK(a.value() == 5);
+    result<int> b(std::make_error_code(std::errc::connection_reset));
+    result<int> c(std::make_error_code(std::errc::connection_reset));
+    outcome<int> d(std::make_error_code(std::errc::connection_refused));
+    BOOST_CHECK(b.has_error() && c.has_error() && d.has_error());
+  }
+  auto samples = snapshot();
+  BOOST_CHECK(count(samples, generic, reset) == before_reset + 2);
+  BOOST_CHECK(count(samples, generic, refused) == before_refused + 1);
+
+  const auto before_exceptions = count(samples, "exception", 0);
+  outcome<int> e(std::make_exception_ptr(5));
+  BOOST_CHECK(e.has_exception());
+  BOOST_CHECK(count(snapshot(), "exception", 0) == before_exceptions + 1);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_metrics / threads, "Tests that the shards of all threads are merged")
+{
+  using namespace error_metrics_test;
+  using OUTCOME_V2_NAMESPACE::metrics::snapshot;
+  const std::string generic = std::generic_category().name();
+  const auto value = static_cast<int>(std::errc::host_unreachable);
+  const auto before = count(snapshot(), generic, value);
+  std::vector<std::thread> threads;
+  for(size_t n = 0; n < 4; n++)
+  {
+    threads.emplace_back([] {
+      for(size_t i = 0; i < 100; i++)
+      {
+        result<void> r(std::make_error_code(std::errc::host_unreachable));
+        (void) r;
+      }
+    });
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  auto samples = snapshot();
+  BOOST_CHECK(count(samples, generic, value) == before + 400);
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::metrics::overflowed() == 0);
+
+  // Merging a snapshot with itself doubles every count
+  auto merged = samples;
+  OUTCOME_V2_NAMESPACE::metrics::merge(merged, samples);
+  BOOST_CHECK(merged.size() == samples.size());
+  BOOST_CHECK(count(merged, generic, value) == 2 * count(samples, generic, value));
+
+  std::stringstream ss;
+  OUTCOME_V2_NAMESPACE::metrics::write_prometheus(ss, samples);
+  const auto text = ss.str();
+  BOOST_CHECK(text.find("# TYPE outcome_failures_total counter\n") != std::string::npos);
+  const auto line = "outcome_failures_total{domain=\"" + generic + "\",value=\"" + std::to_string(value) + "\"} " + std::to_string(count(samples, generic, value)) + "\n";
+  BOOST_CHECK(text.find(line) != std::string::npos);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_metrics / shard_allocation, "Tests that shards are cache line aligned, and failures are not lost silently if a shard cannot be allocated")
+{
+  using namespace error_metrics_test;
+  using OUTCOME_V2_NAMESPACE::metrics::snapshot;
+  const std::string generic = std::generic_category().name();
+  const auto value = static_cast<int>(std::errc::not_enough_memory);
+  const auto before = count(snapshot(), generic, value);
+  const auto before_overflowed = OUTCOME_V2_NAMESPACE::metrics::overflowed();
+  // Hold every existing shard so the new thread must allocate its own
+  std::vector<std::thread> holders;
+  std::atomic<bool> release{false};
+  std::atomic<size_t> holding{0};
+  for(size_t n = 0; n < 8; n++)
+  {
+    holders.emplace_back([&] {
+      result<void> r(std::make_error_code(std::errc::interrupted));
+      (void) r;
+      ++holding;
+      while(!release)
+      {
+        std::this_thread::yield();
+      }
+    });
+  }
+  while(holding < holders.size())
+  {
+    std::this_thread::yield();
+  }
+  std::thread([] {
+    fail_nothrow_new = true;
+    result<void> a(std::make_error_code(std::errc::not_enough_memory));
+    BOOST_CHECK(a.has_error());
+    fail_nothrow_new = false;
+    result<void> b(std::make_error_code(std::errc::not_enough_memory));
+    BOOST_CHECK(b.has_error());
+  }).join();
+  release = true;
+  for(auto &t : holders)
+  {
+    t.join();
+  }
+  BOOST_CHECK(count(snapshot(), generic, value) == before + 1);
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::metrics::overflowed() == before_overflowed + 1);
+
+  for(const auto *sh = OUTCOME_V2_NAMESPACE::metrics::detail::shard_list().load(); sh != nullptr; sh = sh->next)
+  {
+    BOOST_CHECK(reinterpret_cast<uintptr_t>(sh) % 64 == 0);  // NOLINT
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_metrics / thread_exit, "Tests that failures after the thread's shard is released are counted as overflowed")
+{
+  using namespace error_metrics_test;
+  using OUTCOME_V2_NAMESPACE::metrics::snapshot;
+  const std::string generic = std::generic_category().name();
+  const auto value = static_cast<int>(std::errc::state_not_recoverable);
+  const auto before = count(snapshot(), generic, value);
+  const auto before_overflowed = OUTCOME_V2_NAMESPACE::metrics::overflowed();
+  struct late_failure
+  {
+    ~late_failure()
+    {
+      result<void> r(std::make_error_code(std::errc::state_not_recoverable));
+      (void) r;
+    }
+  };
+  std::thread([] {
+    // Constructed before the shard is claimed, so destroyed after it is released
+    static thread_local late_failure l;
+    (void) &l;
+    result<void> r(std::make_error_code(std::errc::state_not_recoverable));
+    (void) r;
+  }).join();
+  BOOST_CHECK(count(snapshot(), generic, value) == before + 1);
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::metrics::overflowed() == before_overflowed + 1);
+}
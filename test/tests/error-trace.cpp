@@ -0,0 +1,215 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/error_trace.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <thread>
+
+namespace error_trace_test
+{
+  template <class T> using result = OUTCOME_V2_NAMESPACE::result<T, std::error_code, OUTCOME_V2_NAMESPACE::policy::error_trace<OUTCOME_V2_NAMESPACE::policy::default_policy<T, std::error_code, void>>>;
+  template <class T> using outcome = OUTCOME_V2_NAMESPACE::outcome<T, std::error_code, std::exception_ptr, OUTCOME_V2_NAMESPACE::policy::error_trace<OUTCOME_V2_NAMESPACE::policy::default_policy<T, std::error_code, std::exception_ptr>>>;
+
+  // Set to make the nothrow operator new on this thread fail
+  static thread_local bool fail_nothrow_new;
+
+  inline size_t count(const std::vector<OUTCOME_V2_NAMESPACE::trace::event> &events, int64_t value)
+  {
+    size_t ret = 0;
+    for(const auto &e : events)
+    {
+      if(e.value == value && e.domain != nullptr && 0 == strcmp(e.domain, std::generic_category().name()))
+      {
+        ret++;
+      }
+    }
+    return ret;
+  }
+}  // namespace error_trace_test
+
+void *operator new(std::size_t size, const std::nothrow_t & /*unused*/) noexcept
+{
+  if(error_trace_test::fail_nothrow_new)
+  {
+    return nullptr;
+  }
+  try
+  {
+    return ::operator new(size);
+  }
+  catch(...)
+  {
+    return nullptr;
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_trace / single_thread, "Tests that failed results are traced and successful ones are not")
+{
+  using namespace error_trace_test;
+  using OUTCOME_V2_NAMESPACE::trace::snapshot;
+  const auto before = count(snapshot(), static_cast<int>(std::errc::file_exists));
+  {
+    result<int> a(5);
+    BOOST_CHECK(a.value() == 5);
+    BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::file_exists)) == before);
+  }
+  {
+    result<int> a(std::make_error_code(std::errc::file_exists));
+    BOOST_CHECK(a.has_error());
+    BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::file_exists)) == before + 1);
+    // Copies are the same failure, but conversions into a new type are traced again
+    result<int> b(a);
+    BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::file_exists)) == before + 1);
+    outcome<int> c(b);
+    BOOST_CHECK(c.has_error());
+    BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::file_exists)) == before + 2);
+  }
+  {
+    outcome<int> a(5);
+    BOOST_CHECK(a.value() == 5);
+    BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::file_exists)) == before + 2);
+  }
+  auto events = snapshot();
+  for(size_t n = 1; n < events.size(); n++)
+  {
+    BOOST_CHECK(events[n - 1].ticks <= events[n].ticks);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_trace / multiple_threads, "Tests that every thread's ring is visible to the reader")
+{
+  using namespace error_trace_test;
+  using OUTCOME_V2_NAMESPACE::trace::snapshot;
+  const auto before = count(snapshot(), static_cast<int>(std::errc::bad_address));
+  std::vector<std::thread> threads;
+  for(size_t n = 0; n < 4; n++)
+  {
+    threads.emplace_back([] {
+      for(size_t i = 0; i < 8; i++)
+      {
+        result<void> r(std::make_error_code(std::errc::bad_address));
+        (void) r;
+      }
+    });
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  auto events = snapshot();
+  BOOST_CHECK(count(events, static_cast<int>(std::errc::bad_address)) == before + 32);
+
+  std::stringstream ss;
+  OUTCOME_V2_NAMESPACE::trace::write_chrome_trace(ss, events);
+  const auto json = ss.str();
+  BOOST_CHECK(json.find("{\"traceEvents\":[") == 0);
+  BOOST_CHECK(json.find("\"ph\":\"i\"") != std::string::npos);
+  BOOST_CHECK(json.find("\"return_address\":") != std::string::npos);
+  BOOST_CHECK(json.find("result<void") != std::string::npos);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_trace / ring_allocation_failure, "Tests that failures are dropped rather than terminating if a ring cannot be allocated")
+{
+  using namespace error_trace_test;
+  using OUTCOME_V2_NAMESPACE::trace::snapshot;
+  const auto before = count(snapshot(), static_cast<int>(std::errc::no_buffer_space));
+  // Hold every existing ring so the new thread must allocate its own
+  std::vector<std::thread> holders;
+  std::atomic<bool> release{false};
+  std::atomic<size_t> holding{0};
+  for(size_t n = 0; n < 8; n++)
+  {
+    holders.emplace_back([&] {
+      result<void> r(std::make_error_code(std::errc::interrupted));
+      (void) r;
+      ++holding;
+      while(!release)
+      {
+        std::this_thread::yield();
+      }
+    });
+  }
+  while(holding < holders.size())
+  {
+    std::this_thread::yield();
+  }
+  std::thread([] {
+    fail_nothrow_new = true;
+    result<void> a(std::make_error_code(std::errc::no_buffer_space));
+    BOOST_CHECK(a.has_error());
+    fail_nothrow_new = false;
+    result<void> b(std::make_error_code(std::errc::no_buffer_space));
+    BOOST_CHECK(b.has_error());
+  }).join();
+  release = true;
+  for(auto &t : holders)
+  {
+    t.join();
+  }
+  BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::no_buffer_space)) == before + 1);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_trace / emplace, "Tests that errors emplaced into an existing result are traced")
+{
+  using namespace error_trace_test;
+  using OUTCOME_V2_NAMESPACE::trace::snapshot;
+  const auto before = count(snapshot(), static_cast<int>(std::errc::broken_pipe));
+  result<int> a(5);
+  a.emplace_error(std::make_error_code(std::errc::broken_pipe));
+  BOOST_CHECK(a.has_error());
+  BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::broken_pipe)) == before + 1);
+  a.emplace_value(6);
+  a.reset_to_value();
+  BOOST_CHECK(a.value() == 6);
+  BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::broken_pipe)) == before + 1);
+  a.emplace_error(static_cast<int>(std::errc::broken_pipe), std::generic_category());
+  BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::broken_pipe)) == before + 2);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_trace / thread_exit, "Tests that failures after the thread's ring is released are dropped")
+{
+  using namespace error_trace_test;
+  using OUTCOME_V2_NAMESPACE::trace::snapshot;
+  const auto before = count(snapshot(), static_cast<int>(std::errc::state_not_recoverable));
+  struct late_failure
+  {
+    ~late_failure()
+    {
+      result<void> r(std::make_error_code(std::errc::state_not_recoverable));
+      (void) r;
+    }
+  };
+  std::thread([] {
+    // Constructed before the ring is claimed, so destroyed after it is released
+    static thread_local late_failure l;
+    (void) &l;
+    result<void> r(std::make_error_code(std::errc::state_not_recoverable));
+    (void) r;
+  }).join();
+  BOOST_CHECK(count(snapshot(), static_cast<int>(std::errc::state_not_recoverable)) == before + 1);
+}
@@ -0,0 +1,88 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/exclusive_outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / exclusive_outcome, "Tests that exclusive_outcome overlaps the exception with the value and error")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(sizeof(exclusive_outcome<int>) == sizeof(result<int>), "exclusive_outcome<int> is not the size of result<int>");
+  static_assert(sizeof(exclusive_outcome<int>) < sizeof(outcome<int>), "exclusive_outcome<int> is not smaller than outcome<int>");
+  static_assert(!std::is_constructible<exclusive_outcome<int>, std::error_code, std::exception_ptr>::value,
+                "exclusive_outcome<int> is constructible from an error plus an exception");
+
+  const auto ec = std::make_error_code(std::errc::io_error);
+  const auto ep = std::make_exception_ptr(std::runtime_error("hello"));
+  exclusive_outcome<std::string> v("niall"), e(ec), x(ep);
+  BOOST_CHECK(v.has_value() && v.value() == "niall");
+  BOOST_CHECK(e.has_error() && !e.has_exception() && e.error() == ec);
+  BOOST_CHECK(!x.has_error() && x.has_exception() && x.exception() == ep);
+  BOOST_CHECK(x.has_failure());
+  BOOST_CHECK(x == exclusive_outcome<std::string>(ep));
+  BOOST_CHECK(x != e);
+#ifdef __cpp_exceptions
+  try
+  {
+    x.value();
+    BOOST_CHECK(false);
+  }
+  catch(const std::runtime_error &err)
+  {
+    BOOST_CHECK(!strcmp(err.what(), "hello"));
+  }
+#endif
+
+  // Each pairing of value, error and exception assigns and swaps
+  exclusive_outcome<std::string> a(v), b(x);
+  a = x;
+  BOOST_CHECK(a.has_exception() && a.exception() == ep);
+  a = e;
+  BOOST_CHECK(a.has_error() && !a.has_exception());
+  a = v;
+  BOOST_CHECK(a.value() == "niall");
+  a.swap(b);
+  BOOST_CHECK(a.exception() == ep && b.value() == "niall");
+  b.swap(e);
+  BOOST_CHECK(b.error() == ec && e.value() == "niall");
+  exclusive_outcome<std::string> m(std::move(a));
+  BOOST_CHECK(m.exception() == ep);
+
+  // Converting from an outcome keeps the exception if it had both, as does the override hook
+  outcome<int> both(ec, ep);
+  exclusive_outcome<int> c(both);
+  BOOST_CHECK(!c.has_error() && c.has_exception() && c.exception() == ep);
+  exclusive_outcome<int> d{outcome<int>(ec)};
+  BOOST_CHECK(d.has_error() && d.error() == ec);
+  exclusive_outcome<int> r{result<int>(5)};
+  BOOST_CHECK(r.value() == 5);
+  hooks::override_outcome_exception(&d, ep);
+  BOOST_CHECK(!d.has_error() && d.exception() == ep);
+  exclusive_outcome<int> f(failure(ec, ep));
+  BOOST_CHECK(!f.has_error() && f.exception() == ep);
+  exclusive_outcome<long> g(c);
+  BOOST_CHECK(g.exception() == ep);
+}
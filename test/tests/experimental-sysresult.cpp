@@ -0,0 +1,45 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#include "../../include/outcome/experimental/status_result.hpp"
+#include "../../include/outcome/sysresult.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cerrno>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / sysresult, "Tests that sysresult converts into status_result")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using ssize = std::make_signed_t<size_t>;
+  static_assert(std::is_constructible<experimental::status_result<ssize>, sysresult<ssize>>::value,
+                "status_result<ssize_t> is not constructible from sysresult<ssize_t>");
+  sysresult<ssize> a = make_sysresult<ssize>(78);
+  experimental::status_result<ssize> b(a);
+  BOOST_CHECK(b.value() == 78);
+  sysresult<ssize> c = make_sysresult<ssize>(-ENOENT);
+  experimental::status_result<ssize> d(c);
+  BOOST_REQUIRE(d.has_error());
+  BOOST_CHECK(d.error() == SYSTEM_ERROR2_NAMESPACE::errc::no_such_file_or_directory);
+  BOOST_CHECK(d.error().domain() == SYSTEM_ERROR2_NAMESPACE::posix_code_domain);
+}
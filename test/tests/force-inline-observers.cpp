@@ -0,0 +1,67 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#define OUTCOME_FORCE_INLINE_OBSERVERS 1
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <stdexcept>
+#include <string>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / force_inline_observers, "Tests that the observers behave the same when forcibly inlined")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  // Still usable in constant expressions
+  static_assert(result<int>(5).value() == 5, "value() is not constexpr");
+  static_assert(result<int, long>(in_place_type<int>, 5).assume_value() == 5, "assume_value() is not constexpr");
+
+  result<std::string> r("hello"), e(std::errc::invalid_argument);
+  BOOST_CHECK(r);
+  BOOST_CHECK(r.has_value());
+  BOOST_CHECK(!r.has_failure());
+  BOOST_CHECK(r.value() == "hello");
+  BOOST_CHECK(std::move(r).assume_value() == "hello");
+  BOOST_CHECK(!e);
+  BOOST_CHECK(e.has_error());
+  BOOST_CHECK(e.error() == std::errc::invalid_argument);
+  BOOST_CHECK(e.assume_error() == std::errc::invalid_argument);
+  BOOST_CHECK_THROW(e.value(), std::system_error);
+  BOOST_CHECK_THROW(r.error(), bad_result_access);
+
+  result<void> v = success();
+  v.value();
+  BOOST_CHECK(v.has_value());
+
+  int x = 5;
+  result<int &> ref(x);
+  BOOST_CHECK(&ref.value() == &x);
+
+  outcome<int> o(std::make_exception_ptr(std::runtime_error("failed"))), ov(5);
+  BOOST_CHECK(o.has_exception());
+  BOOST_CHECK(o.has_failure());
+  BOOST_CHECK(o.exception() != nullptr);
+  BOOST_CHECK_THROW(o.value(), std::runtime_error);
+  BOOST_CHECK_THROW(ov.exception(), bad_outcome_access);
+  BOOST_CHECK(ov.value() == 5);
+}
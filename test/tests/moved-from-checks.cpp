@@ -0,0 +1,81 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define OUTCOME_ENABLE_MOVED_FROM_CHECKS 1
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace moved_from_checks_test
+{
+  static OUTCOME_V2_NAMESPACE::moved_from_site last_site;
+  static int reports;
+  inline void handler(const OUTCOME_V2_NAMESPACE::moved_from_site &site)
+  {
+    last_site = site;
+    reports++;
+  }
+}  // namespace moved_from_checks_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / moved_from_checks, "Tests that reads of moved-from results are reported with their site")
+{
+  using namespace moved_from_checks_test;
+  using OUTCOME_V2_NAMESPACE::result;
+  auto *old = OUTCOME_V2_NAMESPACE::set_moved_from_handler(handler);
+  {
+    result<std::string> a("hello");
+    BOOST_CHECK(a.value() == "hello");
+    BOOST_CHECK(reports == 0);
+    result<std::string> b(std::move(a));
+    BOOST_CHECK(b.value() == "hello");
+    BOOST_CHECK(reports == 0);
+    // Status observers remain usable after a move
+    BOOST_CHECK(a.has_value());
+    BOOST_CHECK(reports == 0);
+    const int line = __LINE__ + 1;
+    (void) a.value();
+    BOOST_CHECK(reports == 1);
+    BOOST_CHECK(last_site.line == static_cast<unsigned>(line));
+    BOOST_CHECK(strstr(last_site.file, "moved-from-checks.cpp") != nullptr);
+    BOOST_CHECK(strcmp(last_site.observer, "value") == 0);
+    (void) a.assume_value();
+    BOOST_CHECK(reports == 2);
+    BOOST_CHECK(strcmp(last_site.observer, "assume_value") == 0);
+    // Assigning a new state clears moved-from
+    a = result<std::string>("world");
+    BOOST_CHECK(a.value() == "world");
+    BOOST_CHECK(reports == 2);
+  }
+  {
+    result<int, std::string> a(std::string("failed"));
+    auto b = std::move(a);
+    BOOST_CHECK(b.error() == "failed");
+    BOOST_CHECK(reports == 2);
+    (void) std::move(a).error();
+    BOOST_CHECK(reports == 3);
+    BOOST_CHECK(strcmp(last_site.observer, "error") == 0);
+  }
+  OUTCOME_V2_NAMESPACE::set_moved_from_handler(old);
+}
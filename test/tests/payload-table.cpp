@@ -0,0 +1,146 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/payload_table.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <thread>
+
+namespace payload_table_test
+{
+  struct request_id
+  {
+    uint64_t id;
+  };
+  using table = OUTCOME_V2_NAMESPACE::payload_table<request_id, 16>;
+
+  static thread_local uint64_t current_request;
+
+  // Attach the current request id to every failure constructed
+  struct attach_request_id : OUTCOME_V2_NAMESPACE::policy::error_code_throw_as_system_error<int, std::error_code, void>
+  {
+    template <class T, class U> static constexpr void on_result_construction(T *inst, U && /*unused*/) noexcept
+    {
+      if(inst->has_error())
+      {
+        table::attach(inst, request_id{current_request});
+      }
+    }
+  };
+  using result = OUTCOME_V2_NAMESPACE::result<int, std::error_code, attach_request_id>;
+}  // namespace payload_table_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / payload_table / lookup, "Tests that payloads attached to failures can be found again, and are detected when stale")
+{
+  using namespace payload_table_test;
+  current_request = 78;
+  result a(5);
+  request_id out{0};
+  BOOST_CHECK(!table::find(&a, out));
+  result b(std::make_error_code(std::errc::invalid_argument));
+  BOOST_CHECK(table::find(&b, out));
+  BOOST_CHECK(out.id == 78);
+  // The payload travels with copies
+  result c(b);
+  out.id = 0;
+  BOOST_CHECK(table::find(&c, out));
+  BOOST_CHECK(out.id == 78);
+  // Once this thread has stored N more payloads, b's slot is stale
+  for(uint64_t n = 0; n < 15; n++)
+  {
+    current_request = 100 + n;
+    result d(std::make_error_code(std::errc::invalid_argument));
+    BOOST_CHECK(table::find(&d, out));
+    BOOST_CHECK(out.id == 100 + n);
+  }
+  BOOST_CHECK(table::find(&b, out));
+  BOOST_CHECK(out.id == 78);
+  current_request = 200;
+  result e(std::make_error_code(std::errc::invalid_argument));
+  BOOST_CHECK(!table::find(&b, out));
+  BOOST_CHECK(table::find(&e, out));
+  BOOST_CHECK(out.id == 200);
+  // Wrap the tags many times over and check lookups remain exact
+  for(uint64_t n = 0; n < 10000; n++)
+  {
+    const auto key = table::store(request_id{n});
+    BOOST_CHECK(key != 0);
+    BOOST_CHECK(table::find(key, out));
+    BOOST_CHECK(out.id == n);
+  }
+  BOOST_CHECK(!table::find(&e, out));
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / payload_table / wrap, "Tests that keys are stale until the tags wrap, and the documented period after which they alias")
+{
+  using namespace payload_table_test;
+  const size_t period = table::tag_period;
+  BOOST_CHECK(period == 2032);
+  request_id out{0};
+  const auto key = table::store(request_id{1});
+  for(size_t n = 1; n < period; n++)
+  {
+    const auto newer = table::store(request_id{1 + n});
+    BOOST_CHECK(newer != key);
+    if(n >= 16)
+    {
+      BOOST_CHECK(!table::find(key, out));
+    }
+  }
+  const auto aliased = table::store(request_id{1 + period});
+  BOOST_CHECK(aliased == key);
+  BOOST_CHECK(table::find(key, out));
+  BOOST_CHECK(out.id == 1 + period);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / payload_table / threads, "Tests that payloads can be found from other threads, including after their thread exits")
+{
+  using namespace payload_table_test;
+  std::vector<result> results;
+  for(uint64_t n = 0; n < 4; n++)
+  {
+    std::thread([&results, n] {
+      current_request = 1000 + n;
+      results.emplace_back(std::make_error_code(std::errc::invalid_argument));
+    }).join();
+  }
+  // Each thread exited before the next started, so they reused the same ring
+  request_id out{0};
+  BOOST_CHECK(table::find(&results[3], out));
+  BOOST_CHECK(out.id == 1003);
+  BOOST_CHECK(table::find(&results[0], out));
+  BOOST_CHECK(out.id == 1000);
+
+  std::thread t1([] {
+    current_request = 2000;
+    result r(std::make_error_code(std::errc::invalid_argument));
+    std::thread t2([&r] {
+      request_id out2{0};
+      BOOST_CHECK(table::find(&r, out2));
+      BOOST_CHECK(out2.id == 2000);
+    });
+    t2.join();
+  });
+  t1.join();
+}
@@ -0,0 +1,126 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <map>
+#include <string>
+
+namespace reference_result_test
+{
+  static int gv = 5;
+  static std::map<int, std::string> cache{{1, "one"}, {2, "two"}};
+
+  static OUTCOME_V2_NAMESPACE::result<std::string &> lookup(int key)
+  {
+    auto it = cache.find(key);
+    if(it == cache.end())
+    {
+      return std::errc::no_such_file_or_directory;
+    }
+    return it->second;
+  }
+  static OUTCOME_V2_NAMESPACE::result<size_t> length(int key)
+  {
+    OUTCOME_TRY(auto &&v, lookup(key));
+    return v.size();
+  }
+}  // namespace reference_result_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / reference, "Tests that result<T &> refers to its value and rebinds on assignment")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace reference_result_test;
+  static_assert(std::is_trivially_copyable<result<std::string &>>::value, "result<std::string &> is not trivially copyable");
+  static_assert(sizeof(result<std::string &>) == sizeof(result<std::string *>), "result<std::string &> is not the size of result<std::string *>");
+  static_assert(std::is_same<decltype(std::declval<result<std::string &>>().value()), std::string &>::value,
+                "result<std::string &>::value() does not return std::string &");
+  static_assert(std::is_same<decltype(std::declval<const result<std::string &> &>().value()), std::string &>::value,
+                "const result<std::string &>::value() does not return std::string &");
+
+  // Observers refer to the cached value, which is not copied
+  result<std::string &> r = lookup(1);
+  BOOST_REQUIRE(r);
+  BOOST_CHECK(&r.value() == &cache[1]);
+  r.value() += "!";
+  BOOST_CHECK(cache[1] == "one!");
+  BOOST_CHECK(*r.value().c_str() == 'o');
+
+  // Assignment rebinds, rather than assigning through
+  r = lookup(2);
+  BOOST_CHECK(&r.value() == &cache[2]);
+  BOOST_CHECK(cache[1] == "one!");
+  std::string other("other");
+  r = other;
+  BOOST_CHECK(&r.value() == &other);
+  BOOST_CHECK(cache[2] == "two");
+
+  // Failure and TRY
+  BOOST_CHECK(lookup(3).error() == std::errc::no_such_file_or_directory);
+  BOOST_CHECK(length(2).value() == 3);
+  BOOST_CHECK(length(3).error() == std::errc::no_such_file_or_directory);
+
+  // Comparison compares what is referred to
+  std::string copy("two");
+  BOOST_CHECK(lookup(2) == result<std::string &>(copy));
+  BOOST_CHECK(lookup(1) != result<std::string &>(copy));
+  BOOST_CHECK(lookup(2) == result<std::string>("two"));
+
+  // Conversions add const, or copy out the value
+  result<const std::string &> c(r);
+  BOOST_CHECK(&c.value() == &other);
+  result<std::string> v(lookup(2));
+  BOOST_CHECK(v.value() == "two");
+  BOOST_CHECK(&v.value() != &cache[2]);
+
+  // With no error to store, the pointer is all there is, and a null pointer is the failure
+  {
+    static_assert(sizeof(result<int &, void>) == sizeof(int *), "result<int &, void> is not the size of a pointer");
+    int x = 5, y = 6;
+    result<int &, void> a(x), b(in_place_type<void>);
+    BOOST_CHECK(a.has_value());
+    BOOST_CHECK(!b.has_value());
+    BOOST_CHECK(b.has_error());
+    a.value() = 7;
+    BOOST_CHECK(x == 7);
+    a = y;
+    BOOST_CHECK(&a.value() == &y);
+    a.swap(b);
+    BOOST_CHECK(!a.has_value());
+    BOOST_CHECK(&b.value() == &y);
+    result<const int &, void> d(b);
+    BOOST_CHECK(&d.value() == &y);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / reference / constexpr, "Tests that result<T &, void> is usable in constant expressions")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using reference_result_test::gv;
+  static constexpr result<int &, void> a(gv), b(in_place_type<void>);
+  static_assert(a.has_value() && !a.has_error(), "result<int &, void> bound to a global does not have a value");
+  static_assert(&a.assume_value() == &gv, "result<int &, void> bound to a global does not refer to it");
+  static_assert(!b.has_value() && b.has_error(), "result<int &, void> of void does not have an error");
+  BOOST_CHECK(a.value() == 5);
+}
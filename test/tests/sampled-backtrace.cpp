@@ -0,0 +1,116 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/sampled_backtrace.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <sstream>
+
+namespace sampled_backtrace_test
+{
+  namespace sampling = OUTCOME_V2_NAMESPACE::backtrace_sampling;
+  using result = OUTCOME_V2_NAMESPACE::result<int, std::error_code, OUTCOME_V2_NAMESPACE::policy::sampled_backtrace<OUTCOME_V2_NAMESPACE::policy::default_policy<int, std::error_code, void>>>;
+
+  // Every failure is constructed from the same site
+  QUICKCPPLIB_NOINLINE inline result fail(std::error_code ec) { return ec; }
+
+  inline uint64_t captures_of(size_t count, std::error_code ec)
+  {
+    const auto before = sampling::current_statistics().captured;
+    for(size_t n = 0; n < count; n++)
+    {
+      result r = fail(ec);
+      (void) r;
+    }
+    return sampling::current_statistics().captured - before;
+  }
+}  // namespace sampled_backtrace_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / sampled_backtrace / throttles, "Tests that the sampler, the category token bucket and the site throttle limit captures")
+{
+  using namespace sampled_backtrace_test;
+  sampling::config c;
+  c.sample_one_in = 4;
+  c.category_per_second = 1000000;
+  c.category_burst = 1000000;
+  c.site_interval_microseconds = 0;
+  sampling::configure(c);
+  BOOST_CHECK(captures_of(100, std::make_error_code(std::errc::invalid_argument)) == 25);
+
+  c.sample_one_in = 1;
+  c.category_per_second = 1;
+  c.category_burst = 5;
+  sampling::configure(c);
+  auto captured = captures_of(100, std::make_error_code(std::errc::invalid_argument));
+  BOOST_CHECK(captured >= 5 && captured <= 6);
+  // A different category has its own bucket
+  captured = captures_of(100, std::make_error_code(std::io_errc::stream));
+  BOOST_CHECK(captured >= 5 && captured <= 6);
+
+  c.category_per_second = 1000000;
+  c.category_burst = 1000000;
+  c.site_interval_microseconds = 60 * 1000 * 1000;
+  sampling::configure(c);
+  BOOST_CHECK(captures_of(100, std::make_error_code(std::errc::invalid_argument)) == 1);
+
+  // A zero rate disables the category limit, whatever the burst
+  c.category_per_second = 0;
+  c.category_burst = 10;
+  c.site_interval_microseconds = 0;
+  sampling::configure(c);
+  const auto throttled = sampling::current_statistics().category_throttled;
+  BOOST_CHECK(captures_of(100, std::make_error_code(std::errc::invalid_argument)) == 100);
+  BOOST_CHECK(sampling::current_statistics().category_throttled == throttled);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / sampled_backtrace / symbolize, "Tests that captured backtraces can be found and symbolised in a batch later")
+{
+  using namespace sampled_backtrace_test;
+  sampling::config c;
+  c.sample_one_in = 1;
+  c.site_interval_microseconds = 0;
+  sampling::configure(c);
+  std::vector<result> results;
+  for(size_t n = 0; n < 8; n++)
+  {
+    results.push_back(fail(std::make_error_code(std::errc::invalid_argument)));
+  }
+  sampling::symbolizer sym;
+  for(auto &r : results)
+  {
+    sampling::raw_backtrace bt;
+    BOOST_CHECK(sampling::table::find(&r, bt));
+    BOOST_CHECK(bt.count > 0);
+    sym.add(bt);
+  }
+  // All eight share the same frames, so there is little to resolve
+  BOOST_CHECK(sym.resolve() > 0);
+  BOOST_CHECK(sym.resolve() == 0);
+  sampling::raw_backtrace bt;
+  BOOST_CHECK(sampling::table::find(&results.front(), bt));
+  BOOST_CHECK(sym.lookup(bt.frames[0]) != nullptr);
+  std::stringstream ss;
+  sym.write(ss, bt);
+  BOOST_CHECK(!ss.str().empty());
+}
@@ -0,0 +1,127 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/sysresult.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cerrno>
+#include <limits>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / sysresult, "Tests that sysresult packs an errno into a single machine word")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using ssize = std::make_signed_t<size_t>;
+  static_assert(sizeof(sysresult<ssize>) == sizeof(ssize), "sysresult<ssize_t> is not one machine word");
+  static_assert(sizeof(sysresult<int>) == sizeof(int), "sysresult<int> is not sized as an int");
+  static_assert(std::is_trivially_copyable<sysresult<ssize>>::value, "sysresult<ssize_t> is not trivially copyable");
+  static_assert(trait::is_error_code_available<packed_errno<ssize>>::value, "packed_errno does not have an error code available");
+  // Writing the value would also rewrite the status, so it is handed out only as const
+  static_assert(std::is_same<decltype(std::declval<sysresult<ssize> &>().value()), const ssize &>::value, "sysresult value() is writable");
+  static_assert(std::is_same<decltype(std::declval<sysresult<ssize> &&>().value()), const ssize &&>::value, "sysresult value() && is writable");
+  static_assert(std::is_same<decltype(std::declval<sysresult<ssize> &>().emplace_value(5)), const ssize &>::value, "sysresult emplace_value() is writable");
+  static_assert(std::is_same<decltype(std::declval<result<ssize> &>().value()), ssize &>::value, "result value() is not writable");
+
+  // The kernel's convention, non-negative is a value and negative is an errno
+  sysresult<ssize> a = make_sysresult<ssize>(78);
+  BOOST_CHECK(a.has_value());
+  BOOST_CHECK(a.value() == 78);
+  sysresult<ssize> b = make_sysresult<ssize>(-EAGAIN);
+  BOOST_CHECK(b.has_error());
+  BOOST_CHECK(b.error().value() == EAGAIN);
+  BOOST_CHECK(b.error() == packed_errno<ssize>(EAGAIN));
+  BOOST_CHECK(!b.has_exception());
+
+  // have_error_is_errno is implied by there being an error
+  struct observe : policy::base
+  {
+    static bool error_is_errno(const sysresult<ssize> &r) { return base::_has_error_is_errno(r); }
+  };
+  BOOST_CHECK(!observe::error_is_errno(a));
+  BOOST_CHECK(observe::error_is_errno(b));
+
+  // libc's convention, -1 and errno
+  errno = ENOENT;
+  sysresult<int> c = make_sysresult_from_errno(-1);
+  BOOST_CHECK(c.error().value() == ENOENT);
+  BOOST_CHECK(make_sysresult_from_errno(5).value() == 5);
+
+  // Construction from std::errc, and conversion into result<T>
+  sysresult<ssize> d(std::errc::bad_file_descriptor);
+  BOOST_CHECK(d.error().value() == EBADF);
+  result<ssize> e(d);
+  BOOST_CHECK(e.error() == std::errc::bad_file_descriptor);
+  result<ssize> f(a);
+  BOOST_CHECK(f.value() == 78);
+  sysresult<int> g(b);
+  BOOST_CHECK(g.error().value() == EAGAIN);
+
+  // TRY propagates the errno
+  auto h = [&]() -> sysresult<ssize> {
+    OUTCOME_TRY(auto &&v, a);
+    OUTCOME_TRY(b);
+    return v;
+  }();
+  BOOST_CHECK(h.error() == b.error());
+  a.swap(h);
+  BOOST_CHECK(a.has_error() && h.value() == 78);
+#ifdef __cpp_exceptions
+  try
+  {
+    d.value();
+    BOOST_CHECK(false);
+  }
+  catch(const std::system_error &ex)
+  {
+    BOOST_CHECK(ex.code() == std::errc::bad_file_descriptor);
+  }
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / sysresult / constexpr, "Tests that sysresult reads its sign correctly, including in constant evaluation")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static constexpr sysresult<int> a(5);
+  static_assert(a.has_value() && !a.has_error(), "sysresult<int>(5) does not have a value");
+  static_assert(a.assume_value() == 5, "sysresult<int>(5) does not have a value of 5");
+  static constexpr sysresult<int> b(0);
+  static_assert(b.has_value() && b.assume_value() == 0, "sysresult<int>(0) does not have a value of 0");
+  static constexpr sysresult<int> c(std::errc::no_such_file_or_directory);
+  static_assert(c.has_error() && !c.has_value(), "sysresult<int>(ENOENT) does not have an error");
+  static_assert(c.assume_error().value() == ENOENT, "sysresult<int>(ENOENT) does not have an error of ENOENT");
+  static_assert(make_sysresult<long>(-EBADF).has_error(), "make_sysresult(-EBADF) does not have an error");
+  static_assert(make_sysresult<long>(0).has_value(), "make_sysresult(0) does not have a value");
+
+  // The largest value and the largest errno both keep their meaning
+  sysresult<long> d(std::numeric_limits<long>::max());
+  BOOST_CHECK(d.value() == std::numeric_limits<long>::max());
+  d = sysresult<long>(packed_errno<long>(4095));
+  BOOST_CHECK(d.error().value() == 4095);
+  d.emplace_value(1L);
+  BOOST_CHECK(d.value() == 1);
+  d.emplace_error(std::errc::interrupted);
+  BOOST_CHECK(d.error().value() == EINTR);
+  d.reset_to_value();
+  BOOST_CHECK(d.value() == 0);
+}
@@ -0,0 +1,86 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+
+// A type whose location matters to nobody, but whose move constructor and swap Outcome cannot see through
+struct relocatable_type
+{
+  int *p{nullptr};
+  relocatable_type() = default;
+  explicit relocatable_type(int v)
+      : p(new int(v))
+  {
+  }
+  relocatable_type(const relocatable_type &o)
+      : p((o.p != nullptr) ? new int(*o.p) : nullptr)
+  {
+  }
+  relocatable_type(relocatable_type &&o)  // NOLINT deliberately not noexcept
+      : p(o.p)
+  {
+    o.p = nullptr;
+  }
+  relocatable_type &operator=(relocatable_type o)
+  {
+    std::swap(p, o.p);
+    return *this;
+  }
+  ~relocatable_type() { delete p; }
+};
+OUTCOME_V2_NAMESPACE_BEGIN
+template <> struct trait::is_trivially_relocatable<relocatable_type>
+{
+  static constexpr bool value = true;
+};
+OUTCOME_V2_NAMESPACE_END
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / trivially_relocatable, "Tests that trivially relocatable results swap by exchanging their bytes")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(trait::is_trivially_relocatable<result<int>>::value, "result<int> is not trivially relocatable");
+  static_assert(trait::is_trivially_relocatable<outcome<int>>::value, "outcome<int> is not trivially relocatable");
+  static_assert(trait::is_trivially_relocatable<result<void, relocatable_type>>::value, "result<void, relocatable_type> is not trivially relocatable");
+  static_assert(!trait::is_trivially_relocatable<result<std::string>>::value, "result<std::string> is trivially relocatable");
+  // Even though its move constructor might throw, relocation cannot
+  static_assert(!std::is_nothrow_move_constructible<relocatable_type>::value, "relocatable_type is nothrow move constructible");
+  static_assert(noexcept(std::declval<result<relocatable_type, std::exception_ptr> &>().swap(std::declval<result<relocatable_type, std::exception_ptr> &>())),
+                "result<relocatable_type, std::exception_ptr> swap is not noexcept");
+
+  using type = result<relocatable_type, std::exception_ptr>;
+  const auto ep = std::make_exception_ptr(5);
+  type a(in_place_type<relocatable_type>, 1), b(in_place_type<relocatable_type>, 2), c(ep);
+  a.swap(b);
+  BOOST_CHECK(*a.value().p == 2 && *b.value().p == 1);
+  a.swap(c);
+  BOOST_CHECK(a.error() == ep && *c.value().p == 2);
+  a.swap(c);
+  BOOST_CHECK(*a.value().p == 2 && c.error() == ep);
+
+  outcome<int> d(5), e(std::make_error_code(std::errc::io_error), ep);
+  d.swap(e);
+  BOOST_CHECK(d.has_error() && d.exception() == ep && e.value() == 5);
+}
@@ -0,0 +1,148 @@
+/* Unit testing for outcomes
+(C) 2024 Niall Douglas <http://www.nedproductions.biz/>
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#if defined(__linux__) && defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__))
+#define OUTCOME_ENABLE_USDT 1
+#endif
+
+#include "../../include/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#if OUTCOME_ENABLE_USDT
+#include <elf.h>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace usdt_test
+{
+  template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+  template <class T> using outcome = OUTCOME_V2_NAMESPACE::outcome<T>;
+
+  QUICKCPPLIB_NOINLINE inline result<int> result_failure() { return std::errc::invalid_argument; }
+  QUICKCPPLIB_NOINLINE inline outcome<int> outcome_failure() { return std::errc::invalid_argument; }
+  QUICKCPPLIB_NOINLINE inline int wide_value_check_failure(const result<int> &r) { return r.value(); }
+
+#if OUTCOME_FOUND_COROUTINE_HEADER
+  inline OUTCOME_V2_NAMESPACE::awaitables::eager<result<int>> coroutine_failure() { co_return std::errc::invalid_argument; }
+#endif
+
+  // Returns the names and semaphore addresses of all the outcome provider probes in .note.stapsdt in this executable
+  inline std::map<std::string, uint64_t> probes_in_this_executable()
+  {
+    std::map<std::string, uint64_t> ret;
+    std::ifstream f("/proc/self/exe", std::ios::binary);
+    const std::vector<char> elf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    if(elf.size() < sizeof(Elf64_Ehdr))
+    {
+      return ret;
+    }
+    Elf64_Ehdr eh;
+    memcpy(&eh, elf.data(), sizeof(eh));
+    std::vector<Elf64_Shdr> sections(eh.e_shnum);
+    memcpy(sections.data(), elf.data() + eh.e_shoff, eh.e_shnum * sizeof(Elf64_Shdr));
+    const char *names = elf.data() + sections[eh.e_shstrndx].sh_offset;
+    for(const auto &sh : sections)
+    {
+      if(0 != strcmp(names + sh.sh_name, ".note.stapsdt"))
+      {
+        continue;
+      }
+      for(size_t offset = 0; offset + sizeof(Elf64_Nhdr) <= sh.sh_size;)
+      {
+        Elf64_Nhdr nh;
+        memcpy(&nh, elf.data() + sh.sh_offset + offset, sizeof(nh));
+        const char *name = elf.data() + sh.sh_offset + offset + sizeof(nh);
+        const char *desc = name + ((nh.n_namesz + 3) & ~3U);
+        if(nh.n_type == 3 && 0 == strcmp(name, "stapsdt"))
+        {
+          // pc, base, semaphore, then provider, name and arguments as strings
+          const char *provider = desc + 3 * sizeof(uint64_t);
+          const char *probe = provider + strlen(provider) + 1;
+          if(0 == strcmp(provider, "outcome"))
+          {
+            uint64_t semaphore;
+            memcpy(&semaphore, desc + 2 * sizeof(uint64_t), sizeof(semaphore));
+            ret[probe] = semaphore;
+          }
+        }
+        offset += sizeof(nh) + ((nh.n_namesz + 3) & ~3U) + ((nh.n_descsz + 3) & ~3U);
+      }
+    }
+    return ret;
+  }
+}  // namespace usdt_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / usdt / probes, "Tests that USDT probes are placed in the executable, and do nothing when not attached")
+{
+  using namespace usdt_test;
+  const auto probes = probes_in_this_executable();
+  BOOST_CHECK(probes.count("result_failure") == 1);
+  BOOST_CHECK(probes.count("outcome_failure") == 1);
+  BOOST_CHECK(probes.count("wide_value_check_failure") == 1);
+#if OUTCOME_FOUND_COROUTINE_HEADER
+  BOOST_CHECK(probes.count("coroutine_complete") == 1);
+  BOOST_CHECK(coroutine_failure().await_resume().has_error());
+#endif
+  // Every probe has a semaphore, which is zero as no tracer is attached
+  for(const auto &p : probes)
+  {
+    BOOST_CHECK(p.second != 0);
+  }
+  BOOST_CHECK(outcome_result_failure_semaphore == 0);
+  BOOST_CHECK(outcome_outcome_failure_semaphore == 0);
+
+  BOOST_CHECK(result_failure().has_error());
+  BOOST_CHECK(outcome_failure().has_error());
+  // Pretend a tracer is attached, so the probe arguments are computed
+  outcome_result_failure_semaphore = 1;
+  outcome_outcome_failure_semaphore = 1;
+  BOOST_CHECK(result_failure().has_error());
+  BOOST_CHECK(outcome_failure().has_error());
+  outcome_result_failure_semaphore = 0;
+  outcome_outcome_failure_semaphore = 0;
+  // Probes are not placed for successful results
+  result<int> r(5);
+  BOOST_CHECK(wide_value_check_failure(r) == 5);
+#ifdef __cpp_exceptions
+  try
+  {
+    wide_value_check_failure(result_failure());
+    BOOST_CHECK(false);
+  }
+  catch(const std::system_error & /*unused*/)
+  {
+  }
+#endif
+}
+
+#else
+BOOST_OUTCOME_AUTO_TEST_CASE(works / usdt / probes, "Tests that USDT probes are placed in the executable, and do nothing when not attached")
+{
+  // USDT probes are only supported on Linux
+}
+#endif